@@ -2,7 +2,10 @@
 
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aColor;
-layout (location = 2) in float aSelected;
+layout (location = 2) in uint aFlags;
+
+const uint POINT_SELECTED = 1u;
+const uint POINT_NOT_DRAWN = 2u | 4u;
 
 uniform mat4 u_ViewProjection;
 uniform float u_PointSize;
@@ -11,15 +14,15 @@ out vec3 vColor;
 out float vSelected;
 
 void main() {
-    if (aSelected < -0.5) {
+    if ((aFlags & POINT_NOT_DRAWN) != 0u) {
         gl_Position = vec4(2.0, 2.0, 2.0, 0.0); 
         return;
     }
 
     vColor = aColor;
-    vSelected = aSelected;
+    vSelected = (aFlags & POINT_SELECTED) != 0u ? 1.0 : 0.0;
 
-    if (aSelected > 0.5) {
+    if (vSelected > 0.5) {
         gl_PointSize = u_PointSize * 1.5; 
     } else {
         gl_PointSize = u_PointSize;
@@ -0,0 +1,50 @@
+#version 460 core
+
+layout (location = 0) in vec4 aPositionAspect;
+layout (location = 1) in vec4 aOrientation;
+layout (location = 2) in uint aFlags;
+
+const uint CAMERA_SELECTED = 1u;
+
+// Image plane corners of the unit frustum; index 0 in EDGES is the apex.
+const vec2 CORNERS[4] = vec2[](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(-1.0, 1.0), vec2(1.0, 1.0));
+const int EDGES[16] = int[](0, 1, 0, 2, 0, 3, 0, 4, 1, 2, 2, 4, 4, 3, 3, 1);
+
+uniform mat4 u_ViewProjection;
+uniform float u_CameraSize;
+uniform vec2 u_ViewportSize;
+uniform float u_CollapsePixels;
+uniform bool u_PointMode;
+
+out vec3 vColor;
+
+vec3 rotate(vec4 q, vec3 v) {
+    return v + 2.0 * cross(q.xyz, cross(q.xyz, v) + q.w * v);
+}
+
+void main() {
+    vColor = (aFlags & CAMERA_SELECTED) != 0u ? vec3(1.0, 1.0, 0.0) : vec3(1.0, 0.5, 0.0);
+
+    vec3 center = aPositionAspect.xyz;
+    vec3 extent = vec3(u_CameraSize * aPositionAspect.w, u_CameraSize, u_CameraSize * 2.0);
+
+    vec4 clipCenter = u_ViewProjection * vec4(center, 1.0);
+    vec4 clipCorner = u_ViewProjection * vec4(center + rotate(aOrientation, extent), 1.0);
+    vec2 screenSpan = (clipCorner.xy / clipCorner.w - clipCenter.xy / clipCenter.w) * 0.5 * u_ViewportSize;
+    bool collapsed = clipCenter.w > 0.0 && clipCorner.w > 0.0 && length(screenSpan) < u_CollapsePixels;
+
+    if (collapsed != u_PointMode) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 0.0);
+        return;
+    }
+
+    if (u_PointMode) {
+        gl_PointSize = 3.0;
+        gl_Position = clipCenter;
+        return;
+    }
+
+    int corner = EDGES[gl_VertexID];
+    vec3 local = corner == 0 ? vec3(0.0) : vec3(CORNERS[corner - 1], 1.0) * extent;
+    gl_Position = u_ViewProjection * vec4(center + rotate(aOrientation, local), 1.0);
+}
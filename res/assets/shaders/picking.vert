@@ -2,20 +2,23 @@
 
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aColor;
-layout (location = 2) in float aSelected;
+layout (location = 2) in uint aFlags;
+
+const uint POINT_NOT_DRAWN = 2u | 4u;
 
 uniform mat4 u_ViewProjection;
 uniform float u_PointSize;
+uniform uint u_BaseIndex;
 
-flat out int v_PointID; 
+flat out uint v_PointID; 
 
 void main() {
-    if (aSelected < -0.5) {
+    if ((aFlags & POINT_NOT_DRAWN) != 0u) {
         gl_Position = vec4(2.0, 2.0, 2.0, 0.0);
         return;
     }
 
-    v_PointID = gl_VertexID;
+    v_PointID = u_BaseIndex + uint(gl_VertexID);
     gl_PointSize = u_PointSize; 
     gl_Position = u_ViewProjection * vec4(aPos, 1.0);
 }
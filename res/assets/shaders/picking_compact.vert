@@ -0,0 +1,37 @@
+#version 460 core
+
+layout (location = 0) in uvec2 aPackedPos;
+layout (location = 2) in uint aFlags;
+
+layout (std430, binding = 0) readonly buffer ChunkBounds {
+    vec4 chunkBounds[];
+};
+
+const uint POINT_NOT_DRAWN = 2u | 4u;
+const uint CHUNK_SHIFT = 16u;
+const uint COORD_MASK = 0x1FFFFFu;
+
+uniform mat4 u_ViewProjection;
+uniform float u_PointSize;
+uniform uint u_BaseIndex;
+
+flat out uint v_PointID;
+
+vec3 decodePosition() {
+    uvec3 q = uvec3(aPackedPos.x & COORD_MASK,
+                    (aPackedPos.x >> 21) | ((aPackedPos.y & 0x3FFu) << 11),
+                    aPackedPos.y >> 10);
+    uint chunk = (u_BaseIndex + uint(gl_VertexID)) >> CHUNK_SHIFT;
+    return chunkBounds[chunk * 2u].xyz + vec3(q) * chunkBounds[chunk * 2u + 1u].xyz;
+}
+
+void main() {
+    if ((aFlags & POINT_NOT_DRAWN) != 0u) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 0.0);
+        return;
+    }
+
+    v_PointID = u_BaseIndex + uint(gl_VertexID);
+    gl_PointSize = u_PointSize;
+    gl_Position = u_ViewProjection * vec4(decodePosition(), 1.0);
+}
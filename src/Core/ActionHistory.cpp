@@ -48,23 +48,33 @@ namespace sfmeditor {
         action.type = ActionType::Delete;
 
         for (const unsigned int idx : m_selectionManager->selectedPointIndices) {
-            action.oldStates.push_back({idx, m_scene->points[idx].position, m_scene->points[idx].selected});
-            m_scene->points[idx].selected = -1.0f;
+            PointCloud& points = m_scene->points;
+            action.oldStates.push_back({idx, points.positions[idx], points.flags[idx]});
+            points.flags[idx] = (points.flags[idx] | PointDeleted) & ~PointSelected;
             m_selectionManager->markAsChanged(idx);
-            action.newStates.push_back({idx, m_scene->points[idx].position, -1.0f});
+            action.newStates.push_back({idx, points.positions[idx], points.flags[idx]});
         }
 
         for (const uint32_t imageID : m_selectionManager->selectedImageIDs) {
-            if (m_scene->images.contains(imageID)) {
-                action.oldImages.push_back({imageID, m_scene->images.at(imageID)});
+            if (const CameraPose* img = m_scene->images.find(imageID)) {
+                action.oldImages.push_back({imageID, *img});
                 m_scene->images.erase(imageID);
             }
         }
+        if (!action.oldImages.empty()) m_selectionManager->markCamerasChanged();
 
+        if (m_scene->streamedPoints) action.streamedPoints = m_scene->streamedPoints->deleteSelected();
+
+        const size_t pointCount = action.oldStates.size() + action.streamedPoints.size();
         m_undoStack.push_back(action);
         m_redoStack.clear();
         m_selectionManager->clearSelection(false);
-        Logger::info(std::format("Deleted {} points and {} images.", action.oldStates.size(), action.oldImages.size()));
+        Logger::info(std::format("Deleted {} points and {} images.", pointCount, action.oldImages.size()));
+    }
+
+    void ActionHistory::clear() {
+        m_undoStack.clear();
+        m_redoStack.clear();
     }
 
     void ActionHistory::undo() {
@@ -74,24 +84,27 @@ namespace sfmeditor {
         m_undoStack.pop_back();
 
         for (const auto& state : action.oldStates) {
-            m_scene->points[state.index].position = state.position;
-            m_scene->points[state.index].selected = state.selected;
+            m_scene->points.positions[state.index] = state.position;
+            m_scene->points.flags[state.index] = state.flags;
             m_selectionManager->markAsChanged(state.index);
+            if (action.type == ActionType::Transform) m_selectionManager->markMoved(state.index);
 
-            if (state.selected > 0.5f) m_selectionManager->addPointToSelection(state.index);
+            if (state.flags & PointSelected) m_selectionManager->addPointToSelection(state.index);
             else m_selectionManager->removePointFromSelection(state.index);
         }
+        if (m_scene->streamedPoints) m_scene->streamedPoints->setDeleted(action.streamedPoints, false);
 
         if (action.type == ActionType::Delete) {
             for (const auto& [imageID, oldImg] : action.oldImages) {
-                m_scene->images[imageID] = oldImg;
+                m_scene->images.insert(imageID, oldImg);
                 m_selectionManager->addImageToSelection(imageID);
             }
         } else {
             for (const auto& [imageID, oldImg] : action.oldImages) {
-                m_scene->images[imageID] = oldImg;
+                m_scene->images.insert(imageID, oldImg);
             }
         }
+        m_selectionManager->markCamerasChanged();
 
         m_editorSystem->updateGizmoCenter();
         m_redoStack.push_back(action);
@@ -105,13 +118,15 @@ namespace sfmeditor {
         m_redoStack.pop_back();
 
         for (const auto& state : action.newStates) {
-            m_scene->points[state.index].position = state.position;
-            m_scene->points[state.index].selected = state.selected;
+            m_scene->points.positions[state.index] = state.position;
+            m_scene->points.flags[state.index] = state.flags;
             m_selectionManager->markAsChanged(state.index);
+            if (action.type == ActionType::Transform) m_selectionManager->markMoved(state.index);
 
-            if (state.selected > 0.5f) m_selectionManager->addPointToSelection(state.index);
+            if (state.flags & PointSelected) m_selectionManager->addPointToSelection(state.index);
             else m_selectionManager->removePointFromSelection(state.index);
         }
+        if (m_scene->streamedPoints) m_scene->streamedPoints->setDeleted(action.streamedPoints, true);
 
         if (action.type == ActionType::Delete) {
             for (const auto& [imageID, oldImg] : action.oldImages) {
@@ -120,9 +135,10 @@ namespace sfmeditor {
             }
         } else {
             for (const auto& [imageID, newImg] : action.newImages) {
-                m_scene->images[imageID] = newImg;
+                m_scene->images.insert(imageID, newImg);
             }
         }
+        m_selectionManager->markCamerasChanged();
 
         m_editorSystem->updateGizmoCenter();
         m_undoStack.push_back(action);
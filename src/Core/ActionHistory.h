@@ -17,6 +17,7 @@
 #pragma once
 
 #include "Types.hpp"
+#include "IO/PointStreamer.h"
 
 #include <vector>
 #include <utility>
@@ -32,7 +33,7 @@ namespace sfmeditor {
     struct PointState {
         unsigned int index;
         glm::vec3 position;
-        float selected;
+        uint8_t flags;
     };
 
     struct EditorAction {
@@ -42,6 +43,8 @@ namespace sfmeditor {
 
         std::vector<std::pair<uint32_t, CameraPose>> oldImages;
         std::vector<std::pair<uint32_t, CameraPose>> newImages;
+
+        std::vector<StreamedPoint> streamedPoints;
     };
 
     class SelectionManager;
@@ -57,6 +60,7 @@ namespace sfmeditor {
         void executeDelete();
         void undo();
         void redo();
+        void clear();
 
     private:
         EditorSystem* m_editorSystem;
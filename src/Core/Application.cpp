@@ -18,6 +18,7 @@
 
 #include "IO/FileDialog.h"
 #include "IO/ModelLoader.h"
+#include "IO/PointStreamer.h"
 #include "IO/SceneExporter.h"
 #include "Logger.h"
 #include "Input.h"
@@ -26,6 +27,7 @@
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <algorithm>
 #include <random>
 #include <glm/gtc/type_ptr.hpp>
 #include <format>
@@ -67,11 +69,13 @@ namespace sfmeditor {
 
         m_sceneProperties = std::make_unique<SceneProperties>();
         m_renderer = std::make_unique<SceneRenderer>();
+        m_streamedRenderer = std::make_unique<StreamedPointRenderer>();
         m_framebuffer = std::make_unique<Framebuffer>(1600, 900);
         m_postProcessFramebuffer = std::make_unique<Framebuffer>(1600, 900);
         m_renderer->initPostProcess();
         m_grid = std::make_unique<SceneGrid>();
         m_lineRenderer = std::make_unique<LineRenderer>();
+        m_frustumRenderer = std::make_unique<FrustumRenderer>();
         m_camera = std::make_unique<EditorCamera>();
         m_editorSystem = std::make_unique<EditorSystem>(m_camera.get(), &m_scene);
         m_editorSystem->sceneProperties = m_sceneProperties.get();
@@ -87,6 +91,10 @@ namespace sfmeditor {
     }
 
     Application::~Application() {
+        if (m_loadTask.valid()) {
+            m_loadProgress->cancel();
+            m_loadTask.wait();
+        }
     }
 
     void Application::run() {
@@ -109,8 +117,18 @@ namespace sfmeditor {
                 m_camera->onResize(viewportInfo.size.x, viewportInfo.size.y);
             }
 
+            pollLoadTask();
+
             // GPU Sync
+            if (m_sceneProperties->compactPointFormat != m_renderer->usesCompactFormat() && !m_scene.points.empty()) {
+                m_renderer->initBuffers(m_scene.points, m_sceneProperties->compactPointFormat);
+            }
             m_renderer->updateBuffers(m_scene.points, m_editorSystem.get());
+            if (m_scene.streamedPoints) {
+                m_scene.streamedPoints->setHostBudget(
+                    static_cast<size_t>(std::max(m_sceneProperties->streamingHostBudgetMB, 0)) << 20);
+                m_scene.streamedPoints->update();
+            }
 
             // System Updates
             m_lineRenderer->onUpdate(m_deltaTime);
@@ -122,24 +140,26 @@ namespace sfmeditor {
             m_framebuffer->bind();
 
             if (m_editorSystem->pendingPickedID) {
-                glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
-                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                m_framebuffer->beginPicking();
 
                 if (m_sceneProperties->showPoints) {
                     m_renderer->renderPickingPass(m_scene.points, m_sceneProperties.get(), m_camera.get());
+                    if (m_scene.streamedPoints) {
+                        m_streamedRenderer->renderPickingPass(m_sceneProperties.get(), m_camera.get());
+                    }
                 }
 
                 const bool isCtrl = Input::isKeyPressed(SFM_KEY_LEFT_CONTROL);
 
                 const glm::vec2 mousePos = m_editorSystem->boxEnd;
 
-                const int pickedID = SceneRenderer::readPointID(
+                const PickedPoint picked = m_framebuffer->readPickedID(
                     static_cast<int>(mousePos.x),
-                    static_cast<int>(mousePos.y),
-                    static_cast<int>(viewportInfo.size.y)
+                    static_cast<int>(viewportInfo.size.y) - static_cast<int>(mousePos.y)
                 );
+                m_framebuffer->endPicking();
 
-                m_editorSystem->getSelectionManager()->processPickedID(pickedID, isCtrl);
+                m_editorSystem->getSelectionManager()->processPickedID(picked.index, picked.node, isCtrl);
                 m_editorSystem->pendingPickedID = false;
             }
 
@@ -152,60 +172,23 @@ namespace sfmeditor {
             glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
             m_grid->draw(m_sceneProperties, m_camera);
+            m_lineRenderer->draw(m_camera);
             m_lineRenderer->clear();
 
-            const float camSize = m_sceneProperties->cameraSize;
-            if (m_sceneProperties->showCameras) {
-                for (const auto& [image_id, img] : m_scene.images) {
-                    if (m_editorSystem->isolatedImageID != 0) {
-                        continue;
-                    }
-
-                    bool isSelected = std::find(m_editorSystem->getSelectionManager()->selectedImageIDs.begin(),
-                                                m_editorSystem->getSelectionManager()->selectedImageIDs.end(),
-                                                image_id) != m_editorSystem->getSelectionManager()->selectedImageIDs.
-                                                                             end();
-
-                    glm::vec3 camColor = isSelected ? glm::vec3(1.0f, 1.0f, 0.0f) : glm::vec3(1.0f, 0.5f, 0.0f);
-
-                    glm::mat4 rotationMatrix = glm::mat4_cast(img.orientation);
-                    glm::mat4 model = glm::translate(glm::mat4(1.0f), img.position) * rotationMatrix;
-
-                    auto center = glm::vec3(model * glm::vec4(0, 0, 0, 1));
-
-                    float aspectRatio = 1.0f;
-                    if (m_scene.cameras.contains(img.cameraID)) {
-                        const auto& cam = m_scene.cameras.at(img.cameraID);
-                        if (cam.height > 0 && cam.width > 0) {
-                            aspectRatio = static_cast<float>(cam.width) / static_cast<float>(cam.height);
-                        }
-                    }
-
-                    float w = camSize * aspectRatio;
-                    float h = camSize;
-                    float z = camSize * 2.0f;
-
-                    auto tl = glm::vec3(model * glm::vec4(-w, -h, z, 1.0f));
-                    auto tr = glm::vec3(model * glm::vec4(w, -h, z, 1.0f));
-                    auto bl = glm::vec3(model * glm::vec4(-w, h, z, 1.0f));
-                    auto br = glm::vec3(model * glm::vec4(w, h, z, 1.0f));
-
-                    m_lineRenderer->addLine(center, tl, camColor, 0.0f);
-                    m_lineRenderer->addLine(center, tr, camColor, 0.0f);
-                    m_lineRenderer->addLine(center, bl, camColor, 0.0f);
-                    m_lineRenderer->addLine(center, br, camColor, 0.0f);
-
-                    m_lineRenderer->addLine(tl, tr, camColor, 0.0f);
-                    m_lineRenderer->addLine(tr, br, camColor, 0.0f);
-                    m_lineRenderer->addLine(br, bl, camColor, 0.0f);
-                    m_lineRenderer->addLine(bl, tl, camColor, 0.0f);
-                }
+            if (m_sceneProperties->showCameras && m_editorSystem->isolatedImageID == 0) {
+                const SelectionManager* selection = m_editorSystem->getSelectionManager();
+                m_frustumRenderer->update(m_scene, selection->selectedImageIDs, selection->cameraRevision);
+                m_frustumRenderer->draw(m_sceneProperties.get(), m_camera.get(), viewportInfo);
             }
 
-            m_lineRenderer->draw(m_camera);
-
             if (m_sceneProperties->showPoints) {
-                m_renderer->render(m_scene.points, m_sceneProperties.get(), m_camera.get());
+                if (m_loadTask.valid()) {
+                    m_renderer->renderPreview(m_sceneProperties.get(), m_camera.get());
+                } else if (m_scene.streamedPoints) {
+                    m_streamedRenderer->render(*m_scene.streamedPoints, m_sceneProperties.get(), m_camera.get());
+                } else {
+                    m_renderer->render(m_scene.points, m_sceneProperties.get(), m_camera.get());
+                }
             }
 
             m_framebuffer->unbind();
@@ -234,6 +217,11 @@ namespace sfmeditor {
             );
             m_uiManager->getViewportPanel()->setTextureID(m_postProcessFramebuffer->getTextureID());
             m_uiManager->renderPanels();
+            if (m_loadTask.valid()) {
+                m_uiManager->renderLoadingOverlay(
+                    "Loading " + std::filesystem::path(m_loadingFilePath).filename().string() + "...",
+                    m_loadProgress->fraction(), [this]() { m_loadProgress->cancel(); });
+            }
             m_uiManager->endFrame();
 
             m_window->onUpdate();
@@ -265,6 +253,12 @@ namespace sfmeditor {
                     ? "points3D.bin"
                     : "points3D.txt");
 
+            if (std::error_code ec; m_scene.features.isLazy() &&
+                std::filesystem::equivalent(std::filesystem::path(m_scene.features.lazySourcePath()).parent_path(),
+                                            folderPath, ec)) {
+                m_scene.features.materialize();
+            }
+
             if (SceneExporter::exportFile(targetFile.string(), m_scene)) {
                 Logger::info("Model exported successfully.");
                 m_currentFilePath = targetFile.string();
@@ -288,7 +282,8 @@ namespace sfmeditor {
 
     void Application::onSaveMap() {
         const auto filter =
-            "Stanford PLY (*.ply)\0*.ply\0"
+            "Stanford PLY Binary (*.ply)\0*.ply\0"
+            "Stanford PLY ASCII (*.ply)\0*.ply\0"
             "Wavefront OBJ (*.obj)\0*.obj\0"
             "XYZ Points (*.xyz)\0*.xyz\0";
 
@@ -299,18 +294,19 @@ namespace sfmeditor {
             std::filesystem::path path(filepath);
 
             if (!path.has_extension()) {
-                if (filterIndex == 1) {
+                if (filterIndex == 1 || filterIndex == 2) {
                     filepath += ".ply";
-                } else if (filterIndex == 2) {
-                    filepath += ".obj";
                 } else if (filterIndex == 3) {
+                    filepath += ".obj";
+                } else if (filterIndex == 4) {
                     filepath += ".xyz";
                 }
             }
 
             Logger::info("Saving map as: " + filepath);
 
-            if (SceneExporter::exportFile(filepath, m_scene)) {
+            const PlyEncoding plyEncoding = (filterIndex == 2) ? PlyEncoding::Ascii : PlyEncoding::BinaryLittleEndian;
+            if (SceneExporter::exportFile(filepath, m_scene, plyEncoding)) {
                 Logger::info("Map saved successfully.");
                 m_currentFilePath = filepath;
             } else {
@@ -320,23 +316,65 @@ namespace sfmeditor {
     }
 
     void Application::loadMap(const std::string& filepath) {
+        if (m_loadTask.valid()) {
+            Logger::warn("Another model is still loading. Wait for it to finish or cancel it first.");
+            return;
+        }
+
         Logger::info("Loading map from: " + filepath);
 
-        const SfMScene newScene = ModelLoader::load(filepath);
+        m_loadProgress = std::make_unique<LoadProgress>();
+        m_loadProgress->enablePreview(m_previewPointBudget);
+        m_renderer->beginPreview(m_previewPointBudget);
+        m_loadingFilePath = filepath;
+
+        LoadOptions options;
+        options.useSceneCache = m_sceneProperties->useSceneCache;
+        options.lazyFeatures = m_sceneProperties->lazyFeatures;
+        options.spatialOrder = m_sceneProperties->spatialPointOrder;
+        options.outOfCore = m_sceneProperties->outOfCorePoints;
+        options.streamingHostBudget = static_cast<size_t>(std::max(m_sceneProperties->streamingHostBudgetMB, 0)) << 20;
+
+        m_loadTask = std::async(std::launch::async, [filepath, options, progress = m_loadProgress.get()]() {
+            return ModelLoader::load(filepath, options, progress);
+        });
+    }
+
+    void Application::pollLoadTask() {
+        if (!m_loadTask.valid()) return;
+
+        if (m_loadProgress->takePreview(m_previewBatch)) {
+            m_renderer->appendPreview(m_previewBatch);
+        }
+
+        if (m_loadTask.wait_for(std::chrono::seconds(0)) != std::future_status::ready) return;
+
+        SfMScene newScene = m_loadTask.get();
+        const bool cancelled = m_loadProgress->isCancelled();
+        m_renderer->endPreview();
+        m_loadProgress.reset();
+        std::vector<PointVertex>().swap(m_previewBatch);
+
+        if (cancelled) return;
 
-        if (newScene.points.empty()) {
+        if (newScene.points.empty() && !newScene.streamedPoints) {
             Logger::warn("File loaded but contained no points or format error.");
             return;
         }
 
-        m_scene = newScene;
+        m_streamedRenderer->reset();
+        m_scene = std::move(newScene);
         m_editorSystem->getSelectionManager()->resetState();
-        m_renderer->initBuffers(m_scene.points);
+        m_editorSystem->getActionHistory()->clear();
+        m_renderer->initBuffers(m_scene.points, m_sceneProperties->compactPointFormat);
 
-        m_currentFilePath = filepath;
+        m_currentFilePath = m_loadingFilePath;
 
+        const uint64_t pointCount = m_scene.streamedPoints
+                                        ? m_scene.streamedPoints->pointCount()
+                                        : m_scene.points.size();
         Logger::info(std::format("Successfully loaded {} points, {} sensors and {} images.",
-                                 m_scene.points.size(), m_scene.cameras.size(), m_scene.images.size()));
+                                 pointCount, m_scene.cameras.size(), m_scene.images.size()));
     }
 
     void Application::onExit() {
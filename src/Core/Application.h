@@ -20,13 +20,17 @@
 #include "Renderer/Framebuffer.h"
 #include "Renderer/EditorCamera.h"
 #include "Renderer/SceneRenderer.h"
+#include "Renderer/StreamedPointRenderer.h"
 #include "Renderer/SceneGrid.h"
 #include "Renderer/LineRenderer.h"
+#include "Renderer/FrustumRenderer.h"
 #include "Types.hpp"
 #include "Window.h"
 #include "EditorSystem.h"
+#include "IO/ModelLoader.h"
 
 #include <memory>
+#include <future>
 #include <glm/glm.hpp>
 
 
@@ -56,6 +60,7 @@ namespace sfmeditor {
         void onSaveMap();
 
         void loadMap(const std::string& filepath);
+        void pollLoadTask();
         void onExit();
 
         float m_lastFrameTime = 0.0f;
@@ -65,10 +70,12 @@ namespace sfmeditor {
         std::unique_ptr<UIManager> m_uiManager;
         std::unique_ptr<SceneProperties> m_sceneProperties;
         std::unique_ptr<SceneRenderer> m_renderer;
+        std::unique_ptr<StreamedPointRenderer> m_streamedRenderer;
         std::unique_ptr<Framebuffer> m_framebuffer;
         std::unique_ptr<Framebuffer> m_postProcessFramebuffer;
         std::unique_ptr<SceneGrid> m_grid;
         std::unique_ptr<LineRenderer> m_lineRenderer;
+        std::unique_ptr<FrustumRenderer> m_frustumRenderer;
         std::unique_ptr<EditorCamera> m_camera;
         std::unique_ptr<EditorSystem> m_editorSystem;
 
@@ -77,5 +84,11 @@ namespace sfmeditor {
         glm::vec2 m_lastViewportSize = {1.0f, 1.0f};
 
         SfMScene m_scene;
+
+        std::future<SfMScene> m_loadTask;
+        std::unique_ptr<LoadProgress> m_loadProgress;
+        std::vector<PointVertex> m_previewBatch;
+        std::string m_loadingFilePath;
+        const size_t m_previewPointBudget = 2'000'000;
     };
 }
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "IdIndex.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sfmeditor {
+    // Contiguous storage for records keyed by sparse 32-bit IDs. Iteration walks the dense value array;
+    // erase swaps the last record into the hole, so iteration order is not stable across erasures.
+    template <typename T>
+    class DenseTable {
+    public:
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        void clear() {
+            m_slots.clear();
+            m_ids.clear();
+            m_values.clear();
+        }
+
+        void reserve(const size_t count) {
+            m_slots.reserve(count);
+            m_ids.reserve(count);
+            m_values.reserve(count);
+        }
+
+        size_t size() const { return m_values.size(); }
+        bool empty() const { return m_values.empty(); }
+
+        bool contains(const uint32_t id) const { return m_slots.contains(id); }
+
+        T* find(const uint32_t id) {
+            const uint32_t slot = m_slots.find(id);
+            return slot != IdIndex::invalid ? &m_values[slot] : nullptr;
+        }
+
+        const T* find(const uint32_t id) const {
+            const uint32_t slot = m_slots.find(id);
+            return slot != IdIndex::invalid ? &m_values[slot] : nullptr;
+        }
+
+        T& insert(const uint32_t id, T value) {
+            if (T* existing = find(id)) {
+                *existing = std::move(value);
+                return *existing;
+            }
+            m_slots.insert(id, static_cast<uint32_t>(m_values.size()));
+            m_ids.push_back(id);
+            m_values.push_back(std::move(value));
+            return m_values.back();
+        }
+
+        bool erase(const uint32_t id) {
+            const uint32_t slot = m_slots.find(id);
+            if (slot == IdIndex::invalid) return false;
+
+            const uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+            if (slot != last) {
+                m_values[slot] = std::move(m_values[last]);
+                m_ids[slot] = m_ids[last];
+                m_slots.insert(m_ids[slot], slot);
+            }
+            m_values.pop_back();
+            m_ids.pop_back();
+            m_slots.erase(id);
+            return true;
+        }
+
+        std::span<const uint32_t> ids() const { return m_ids; }
+
+        iterator begin() { return m_values.begin(); }
+        iterator end() { return m_values.end(); }
+        const_iterator begin() const { return m_values.begin(); }
+        const_iterator end() const { return m_values.end(); }
+
+    private:
+        IdIndex m_slots;
+        std::vector<uint32_t> m_ids;
+        std::vector<T> m_values;
+    };
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace sfmeditor {
+    // Tracks modified elements at page granularity. Marking is idempotent, so the upload cost is bounded by the
+    // number of distinct dirty pages; adjacent dirty pages are coalesced into a single range.
+    class DirtyRanges {
+    public:
+        static constexpr uint32_t pageShift = 10;
+        static constexpr size_t pageSize = size_t(1) << pageShift;
+
+        void mark(const uint32_t idx) {
+            const size_t page = idx >> pageShift;
+            const size_t word = page >> 6;
+            if (word >= m_words.size()) m_words.resize(std::max(word + 1, m_words.size() * 2), 0);
+
+            const uint64_t bit = uint64_t(1) << (page & 63);
+            if (!(m_words[word] & bit)) {
+                m_words[word] |= bit;
+                ++m_pageCount;
+            }
+        }
+
+        void markAll(const size_t count) {
+            const size_t pages = (count + pageSize - 1) >> pageShift;
+            if (pages == 0) return;
+
+            m_words.resize(std::max(m_words.size(), (pages + 63) / 64), 0);
+            std::fill(m_words.begin(), m_words.begin() + static_cast<std::ptrdiff_t>(pages / 64), ~uint64_t(0));
+            if (pages % 64) m_words[pages / 64] |= (uint64_t(1) << (pages % 64)) - 1;
+
+            m_pageCount = 0;
+            for (const uint64_t w : m_words) m_pageCount += std::popcount(w);
+        }
+
+        void clear() {
+            if (m_pageCount == 0) return;
+            std::fill(m_words.begin(), m_words.end(), 0);
+            m_pageCount = 0;
+        }
+
+        bool empty() const { return m_pageCount == 0; }
+        size_t pageCount() const { return m_pageCount; }
+
+        // Calls fn(begin, count) once per maximal run of dirty pages, clamped to itemCount.
+        template <typename Fn>
+        void forEachRange(const size_t itemCount, Fn&& fn) const {
+            size_t runStart = 0, runEnd = 0;
+            for (size_t w = 0; w < m_words.size(); ++w) {
+                for (uint64_t bits = m_words[w]; bits; bits &= bits - 1) {
+                    const size_t page = w * 64 + std::countr_zero(bits);
+                    if (page != runEnd) {
+                        emit(runStart, runEnd, itemCount, fn);
+                        runStart = page;
+                    }
+                    runEnd = page + 1;
+                }
+            }
+            emit(runStart, runEnd, itemCount, fn);
+        }
+
+    private:
+        template <typename Fn>
+        static void emit(const size_t firstPage, const size_t endPage, const size_t itemCount, Fn& fn) {
+            const size_t begin = firstPage << pageShift;
+            const size_t end = std::min(endPage << pageShift, itemCount);
+            if (begin < end) fn(begin, end - begin);
+        }
+
+        std::vector<uint64_t> m_words;
+        size_t m_pageCount = 0;
+    };
+}
@@ -51,7 +51,7 @@ namespace sfmeditor {
                         float minDepth = FLT_MAX;
                         const glm::mat4 vp = m_camera->getViewProjection();
 
-                        for (const auto& [id, cam] : m_scene->images) {
+                        for (const CameraPose& cam : m_scene->images) {
                             glm::vec4 clipPos = vp * glm::vec4(cam.position, 1.0f);
                             if (clipPos.w > 0.01f) {
                                 glm::vec2 ndc = glm::vec2(clipPos.x, clipPos.y) / clipPos.w;
@@ -61,7 +61,7 @@ namespace sfmeditor {
                                 };
                                 if (glm::distance(screenPos, end) < 25.0f && clipPos.w < minDepth) {
                                     minDepth = clipPos.w;
-                                    hitCameraID = id;
+                                    hitCameraID = cam.imageID;
                                 }
                             }
                         }
@@ -69,9 +69,7 @@ namespace sfmeditor {
                         if (hitCameraID != 0) {
                             if (!Input::isKeyPressed(SFM_KEY_LEFT_CONTROL)) m_selectionManager->clearSelection();
 
-                            auto& camList = m_selectionManager->selectedImageIDs;
-                            if (std::find(camList.begin(), camList.end(), hitCameraID) != camList.
-                                end())
+                            if (m_selectionManager->selectedImageIDs.contains(hitCameraID))
                                 m_selectionManager->removeImageFromSelection(hitCameraID);
                             else m_selectionManager->addImageToSelection(hitCameraID);
                             updateGizmoCenter();
@@ -136,20 +134,20 @@ namespace sfmeditor {
             m_dragStartStates.clear();
             m_dragStartCamStates.clear();
             for (const unsigned int idx : m_selectionManager->selectedPointIndices) {
-                m_dragStartStates.push_back({idx, m_scene->points[idx].position, m_scene->points[idx].selected});
+                m_dragStartStates.push_back({idx, m_scene->points.positions[idx], m_scene->points.flags[idx]});
             }
             for (const unsigned int id : m_selectionManager->selectedImageIDs) {
-                if (m_scene->images.contains(id)) m_dragStartCamStates.push_back({id, m_scene->images.at(id)});
+                if (const CameraPose* img = m_scene->images.find(id)) m_dragStartCamStates.push_back({id, *img});
             }
         } else if (!isUsingGizmo && m_wasUsingGizmo) {
             std::vector<PointState> newPointStates;
             std::vector<std::pair<uint32_t, CameraPose>> newCamStates;
 
             for (const unsigned int idx : m_selectionManager->selectedPointIndices) {
-                newPointStates.push_back({idx, m_scene->points[idx].position, m_scene->points[idx].selected});
+                newPointStates.push_back({idx, m_scene->points.positions[idx], m_scene->points.flags[idx]});
             }
             for (const unsigned int id : m_selectionManager->selectedImageIDs) {
-                if (m_scene->images.contains(id)) newCamStates.push_back({id, m_scene->images.at(id)});
+                if (const CameraPose* img = m_scene->images.find(id)) newCamStates.push_back({id, *img});
             }
 
             m_actionHistory->recordTransformAction(m_dragStartStates, newPointStates, m_dragStartCamStates,
@@ -157,7 +155,7 @@ namespace sfmeditor {
         }
         m_wasUsingGizmo = isUsingGizmo;
 
-        if (m_selectionManager->hasSelection() && gizmoOperation != -1 && isUsingGizmo) {
+        if (m_selectionManager->hasTransformableSelection() && gizmoOperation != -1 && isUsingGizmo) {
             bool isMatrixChanged = false;
             for (int i = 0; i < 4; ++i) {
                 for (int j = 0; j < 4; ++j) {
@@ -174,18 +172,18 @@ namespace sfmeditor {
                 const glm::quat deltaRot = glm::quat_cast(deltaTransform);
 
                 for (const unsigned int idx : m_selectionManager->selectedPointIndices) {
-                    m_scene->points[idx].position = glm::vec3(
-                        deltaTransform * glm::vec4(m_scene->points[idx].position, 1.0f));
-                    m_selectionManager->markAsChanged(idx);
+                    glm::vec3& position = m_scene->points.positions[idx];
+                    position = glm::vec3(deltaTransform * glm::vec4(position, 1.0f));
+                    m_selectionManager->markMoved(idx);
                 }
 
                 for (const uint32_t camID : m_selectionManager->selectedImageIDs) {
-                    if (m_scene->images.contains(camID)) {
-                        auto& cam = m_scene->images.at(camID);
-                        cam.position = glm::vec3(deltaTransform * glm::vec4(cam.position, 1.0f));
-                        cam.orientation = glm::normalize(deltaRot * cam.orientation);
+                    if (CameraPose* cam = m_scene->images.find(camID)) {
+                        cam->position = glm::vec3(deltaTransform * glm::vec4(cam->position, 1.0f));
+                        cam->orientation = glm::normalize(deltaRot * cam->orientation);
                     }
                 }
+                if (!m_selectionManager->selectedImageIDs.empty()) m_selectionManager->markCamerasChanged();
 
                 gizmoLastTransform = gizmoTransform;
             }
@@ -200,18 +198,18 @@ namespace sfmeditor {
     }
 
     void EditorSystem::updateGizmoCenter() {
-        if (m_selectionManager->hasSelection()) {
+        if (m_selectionManager->hasTransformableSelection()) {
             glm::vec3 center(0.0f);
             float count = 0;
             for (const unsigned int idx : m_selectionManager->selectedPointIndices) {
-                if (m_scene->points[idx].selected > -0.5f) {
-                    center += m_scene->points[idx].position;
+                if (m_scene->points.isVisible(idx)) {
+                    center += m_scene->points.positions[idx];
                     count++;
                 }
             }
             for (const uint32_t id : m_selectionManager->selectedImageIDs) {
-                if (m_scene->images.contains(id)) {
-                    center += m_scene->images.at(id).position;
+                if (const CameraPose* img = m_scene->images.find(id)) {
+                    center += img->position;
                     count++;
                 }
             }
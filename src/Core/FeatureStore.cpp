@@ -0,0 +1,222 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FeatureStore.h"
+#include "Parallel.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace sfmeditor {
+    namespace {
+        struct FeatureBlock {
+            std::vector<glm::vec2> coordinates;
+            std::vector<uint32_t> pointIndices;
+        };
+    }
+
+    struct FeatureStore::LazyCache {
+        FeatureReader reader;
+        size_t residentBudget = 0;
+        size_t residentCount = 0;
+
+        std::mutex mutex;
+        std::list<uint32_t> order;
+        using ResidentBlock = std::pair<std::shared_ptr<const FeatureBlock>, std::list<uint32_t>::iterator>;
+        std::unordered_map<uint32_t, ResidentBlock> resident;
+    };
+
+    FeatureStore::FeatureStore() = default;
+    FeatureStore::~FeatureStore() = default;
+    FeatureStore::FeatureStore(FeatureStore&& other) noexcept = default;
+    FeatureStore& FeatureStore::operator=(FeatureStore&& other) noexcept = default;
+
+    void FeatureStore::clear() {
+        m_rangeSlots.clear();
+        m_ranges.clear();
+        m_coordinates.clear();
+        m_pointIndices.clear();
+        m_pendingPointIds.clear();
+        m_pointSlots.reset();
+        m_sourcePath.clear();
+        m_lazy.reset();
+    }
+
+    void FeatureStore::reserve(const size_t imageCount, const size_t featureCount) {
+        m_ranges.reserve(imageCount);
+        m_rangeSlots.reserve(imageCount);
+        m_coordinates.values().reserve(featureCount);
+        m_pointIndices.values().reserve(featureCount);
+    }
+
+    void FeatureStore::append(const uint32_t imageID, const std::span<const glm::vec2> coordinates,
+                              const std::span<const uint64_t> pointIds) {
+        setRange(imageID, m_coordinates.size(), coordinates.size());
+        std::vector<glm::vec2>& ownedCoordinates = m_coordinates.values();
+        ownedCoordinates.insert(ownedCoordinates.end(), coordinates.begin(), coordinates.end());
+        m_pointIndices.values().resize(ownedCoordinates.size(), noPoint);
+        m_pendingPointIds.insert(m_pendingPointIds.end(), pointIds.begin(), pointIds.end());
+    }
+
+    void FeatureStore::assign(MappedArray<glm::vec2> coordinates, MappedArray<uint32_t> pointIndices) {
+        m_coordinates = std::move(coordinates);
+        m_pointIndices = std::move(pointIndices);
+        if (m_pointIndices.size() != m_coordinates.size()) {
+            m_pointIndices.values().resize(m_coordinates.size(), noPoint);
+        }
+        m_pendingPointIds.clear();
+    }
+
+    void FeatureStore::setRange(const uint32_t imageID, const uint64_t offset, const uint64_t count) {
+        if (const uint32_t slot = m_rangeSlots.find(imageID); slot != IdIndex::invalid) {
+            m_ranges[slot] = {imageID, offset, count};
+            return;
+        }
+        m_rangeSlots.insert(imageID, static_cast<uint32_t>(m_ranges.size()));
+        m_ranges.push_back({imageID, offset, count});
+    }
+
+    void FeatureStore::resolvePoints(std::shared_ptr<const IdIndex> pointSlots) {
+        m_pointSlots = std::move(pointSlots);
+
+        if (m_pendingPointIds.size() == m_pointIndices.size()) {
+            uint32_t* pointIndices = m_pointIndices.values().data();
+            parallelFor(m_pointIndices.size(), [&](const size_t begin, const size_t end) {
+                resolveBlock({m_pendingPointIds.data() + begin, end - begin}, pointIndices + begin);
+            });
+        }
+        m_pendingPointIds.clear();
+        m_pendingPointIds.shrink_to_fit();
+
+        // Eager stores never look points up again, so only lazy ones keep the index around.
+        if (!m_lazy) m_pointSlots.reset();
+    }
+
+    void FeatureStore::remapPoints(const std::span<const uint32_t> newIndices) {
+        std::vector<uint32_t>& pointIndices = m_pointIndices.values();
+        parallelFor(pointIndices.size(), [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                if (pointIndices[i] != noPoint) pointIndices[i] = newIndices[pointIndices[i]];
+            }
+        });
+
+        // Resident lazy blocks were resolved against the old order; they are reloaded on next use.
+        if (m_lazy) {
+            std::lock_guard lock(m_lazy->mutex);
+            m_lazy->resident.clear();
+            m_lazy->order.clear();
+            m_lazy->residentCount = 0;
+        }
+    }
+
+    void FeatureStore::resolveBlock(const std::span<const uint64_t> pointIds, uint32_t* outIndices) const {
+        for (size_t i = 0; i < pointIds.size(); ++i) {
+            outIndices[i] = m_pointSlots ? m_pointSlots->find(pointIds[i]) : noPoint;
+        }
+    }
+
+    void FeatureStore::setLazySource(const std::string& sourcePath, FeatureReader reader, const size_t residentBudget) {
+        m_sourcePath = sourcePath;
+        m_lazy = std::make_unique<LazyCache>();
+        m_lazy->reader = std::move(reader);
+        m_lazy->residentBudget = residentBudget;
+    }
+
+    void FeatureStore::setLazy(const uint32_t imageID, const uint64_t fileOffset, const uint64_t count) {
+        setRange(imageID, fileOffset, count);
+    }
+
+    bool FeatureStore::find(const uint32_t imageID, uint64_t& outOffset, uint64_t& outCount) const {
+        const uint32_t slot = m_rangeSlots.find(imageID);
+        if (slot == IdIndex::invalid) return false;
+        outOffset = m_ranges[slot].offset;
+        outCount = m_ranges[slot].count;
+        return true;
+    }
+
+    size_t FeatureStore::count(const uint32_t imageID) const {
+        const uint32_t slot = m_rangeSlots.find(imageID);
+        return slot != IdIndex::invalid ? m_ranges[slot].count : 0;
+    }
+
+    FeatureView FeatureStore::get(const uint32_t imageID) const {
+        const uint32_t slot = m_rangeSlots.find(imageID);
+        if (slot == IdIndex::invalid) return {};
+
+        const Range& range = m_ranges[slot];
+        if (!m_lazy) {
+            if (range.offset > m_coordinates.size() || range.count > m_coordinates.size() - range.offset) return {};
+            return {
+                {m_coordinates.data() + range.offset, range.count},
+                {m_pointIndices.data() + range.offset, range.count},
+                nullptr
+            };
+        }
+
+        std::lock_guard lock(m_lazy->mutex);
+        std::shared_ptr<const FeatureBlock> block;
+        if (const auto cached = m_lazy->resident.find(imageID); cached != m_lazy->resident.end()) {
+            m_lazy->order.splice(m_lazy->order.begin(), m_lazy->order, cached->second.second);
+            block = cached->second.first;
+        } else {
+            auto loaded = std::make_shared<FeatureBlock>();
+            std::vector<uint64_t> pointIds;
+            m_lazy->reader(range.offset, range.count, loaded->coordinates, pointIds);
+            loaded->pointIndices.resize(loaded->coordinates.size(), noPoint);
+            if (pointIds.size() == loaded->coordinates.size()) resolveBlock(pointIds, loaded->pointIndices.data());
+            block = loaded;
+
+            m_lazy->order.push_front(imageID);
+            m_lazy->resident[imageID] = {block, m_lazy->order.begin()};
+            m_lazy->residentCount += block->coordinates.size();
+
+            while (m_lazy->residentCount > m_lazy->residentBudget && m_lazy->order.size() > 1) {
+                const uint32_t evicted = m_lazy->order.back();
+                m_lazy->residentCount -= m_lazy->resident[evicted].first->coordinates.size();
+                m_lazy->resident.erase(evicted);
+                m_lazy->order.pop_back();
+            }
+        }
+        return {block->coordinates, block->pointIndices, block};
+    }
+
+    void FeatureStore::materialize() {
+        if (!m_lazy) return;
+
+        uint64_t total = 0;
+        for (const Range& range : m_ranges) total += range.count;
+
+        std::vector<glm::vec2> coordinates;
+        std::vector<uint32_t> pointIndices;
+        coordinates.reserve(total);
+        pointIndices.reserve(total);
+
+        for (Range& range : m_ranges) {
+            const FeatureView features = get(range.imageID);
+            range.offset = coordinates.size();
+            range.count = features.size();
+            coordinates.insert(coordinates.end(), features.coordinates.begin(), features.coordinates.end());
+            pointIndices.insert(pointIndices.end(), features.pointIndices.begin(), features.pointIndices.end());
+        }
+
+        m_coordinates = std::move(coordinates);
+        m_pointIndices = std::move(pointIndices);
+        m_pointSlots.reset();
+        m_lazy.reset();
+        m_sourcePath.clear();
+    }
+}
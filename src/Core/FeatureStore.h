@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "IdIndex.hpp"
+#include "MappedArray.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace sfmeditor {
+    // Features of one image. Spans stay valid for as long as the view is held, even if a lazy store evicts them.
+    struct FeatureView {
+        std::span<const glm::vec2> coordinates;
+        std::span<const uint32_t> pointIndices;
+        std::shared_ptr<const void> owner;
+
+        size_t size() const { return coordinates.size(); }
+        bool empty() const { return coordinates.empty(); }
+    };
+
+    // Columnar 2D features for all images. Each feature references its 3D point by dense index into
+    // SfMScene::points; COLMAP point IDs are resolved once through resolvePoints().
+    class FeatureStore {
+    public:
+        static constexpr uint32_t noPoint = IdIndex::invalid;
+
+        using FeatureReader = std::function<void(uint64_t fileOffset, uint64_t count,
+                                                 std::vector<glm::vec2>& outCoordinates,
+                                                 std::vector<uint64_t>& outPointIds)>;
+
+        FeatureStore();
+        ~FeatureStore();
+        FeatureStore(FeatureStore&& other) noexcept;
+        FeatureStore& operator=(FeatureStore&& other) noexcept;
+
+        void clear();
+        void reserve(size_t imageCount, size_t featureCount);
+
+        void append(uint32_t imageID, std::span<const glm::vec2> coordinates, std::span<const uint64_t> pointIds);
+        void assign(MappedArray<glm::vec2> coordinates, MappedArray<uint32_t> pointIndices);
+        void setRange(uint32_t imageID, uint64_t offset, uint64_t count);
+        void resolvePoints(std::shared_ptr<const IdIndex> pointSlots);
+        void remapPoints(std::span<const uint32_t> newIndices);
+
+        void setLazySource(const std::string& sourcePath, FeatureReader reader, size_t residentBudget);
+        void setLazy(uint32_t imageID, uint64_t fileOffset, uint64_t count);
+
+        bool isLazy() const { return m_lazy != nullptr; }
+        const std::string& lazySourcePath() const { return m_sourcePath; }
+
+        // Offset is into the feature columns, or into the source file when the store is lazy.
+        bool find(uint32_t imageID, uint64_t& outOffset, uint64_t& outCount) const;
+        size_t count(uint32_t imageID) const;
+        FeatureView get(uint32_t imageID) const;
+
+        std::span<const glm::vec2> coordinates() const { return m_coordinates.span(); }
+        std::span<const uint32_t> pointIndices() const { return m_pointIndices.span(); }
+
+        void materialize();
+
+    private:
+        struct Range {
+            uint32_t imageID;
+            uint64_t offset;
+            uint64_t count;
+        };
+
+        struct LazyCache;
+
+        void resolveBlock(std::span<const uint64_t> pointIds, uint32_t* outIndices) const;
+
+        IdIndex m_rangeSlots;
+        std::vector<Range> m_ranges;
+        MappedArray<glm::vec2> m_coordinates;
+        MappedArray<uint32_t> m_pointIndices;
+        std::vector<uint64_t> m_pendingPointIds;
+        std::shared_ptr<const IdIndex> m_pointSlots;
+
+        std::string m_sourcePath;
+        std::unique_ptr<LazyCache> m_lazy;
+    };
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace sfmeditor {
+    // View frustum planes extracted from a view-projection matrix (Gribb/Hartmann), normals pointing inward.
+    struct Frustum {
+        glm::vec4 planes[6];
+
+        explicit Frustum(const glm::mat4& viewProjection) {
+            const glm::mat4 m = glm::transpose(viewProjection);
+            planes[0] = m[3] + m[0];
+            planes[1] = m[3] - m[0];
+            planes[2] = m[3] + m[1];
+            planes[3] = m[3] - m[1];
+            planes[4] = m[3] + m[2];
+            planes[5] = m[3] - m[2];
+        }
+
+        bool intersects(const glm::vec3& min, const glm::vec3& max) const {
+            for (const glm::vec4& plane : planes) {
+                const glm::vec3 positive(plane.x >= 0.0f ? max.x : min.x, plane.y >= 0.0f ? max.y : min.y,
+                                         plane.z >= 0.0f ? max.z : min.z);
+                if (glm::dot(glm::vec3(plane), positive) + plane.w < 0.0f) return false;
+            }
+            return true;
+        }
+    };
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace sfmeditor {
+    // Maps sparse 64-bit IDs to dense 32-bit slots. IDs that fit a small range use a direct lookup table;
+    // anything else falls back to open addressing with linear probing.
+    class IdIndex {
+    public:
+        static constexpr uint32_t invalid = UINT32_MAX;
+
+        void clear() {
+            m_direct.clear();
+            m_keys.clear();
+            m_slots.clear();
+            m_count = 0;
+            m_hashed = false;
+        }
+
+        void reserve(const size_t count) {
+            if (m_hashed) rehash(capacityFor(count));
+        }
+
+        size_t size() const { return m_count; }
+
+        void insert(const uint64_t key, const uint32_t slot) {
+            if (!m_hashed) {
+                if (key < m_direct.size()) {
+                    if (m_direct[key] == invalid) ++m_count;
+                    m_direct[key] = slot;
+                    return;
+                }
+                if (key < directLimit(m_count + 1)) {
+                    m_direct.resize(std::max<size_t>(key + 1, m_direct.size() * 2), invalid);
+                    m_direct[key] = slot;
+                    ++m_count;
+                    return;
+                }
+                convertToHashed();
+            }
+
+            if ((m_count + 1) * 2 > m_slots.size()) rehash(capacityFor(m_count + 1));
+
+            size_t i = bucket(key);
+            while (m_slots[i] != invalid && m_keys[i] != key) i = (i + 1) & (m_slots.size() - 1);
+            if (m_slots[i] == invalid) ++m_count;
+            m_keys[i] = key;
+            m_slots[i] = slot;
+        }
+
+        uint32_t find(const uint64_t key) const {
+            if (!m_hashed) return key < m_direct.size() ? m_direct[key] : invalid;
+            if (m_slots.empty()) return invalid;
+
+            for (size_t i = bucket(key); m_slots[i] != invalid; i = (i + 1) & (m_slots.size() - 1)) {
+                if (m_keys[i] == key) return m_slots[i];
+            }
+            return invalid;
+        }
+
+        bool contains(const uint64_t key) const { return find(key) != invalid; }
+
+        void erase(const uint64_t key) {
+            if (!m_hashed) {
+                if (key < m_direct.size() && m_direct[key] != invalid) {
+                    m_direct[key] = invalid;
+                    --m_count;
+                }
+                return;
+            }
+            if (m_slots.empty()) return;
+
+            const size_t mask = m_slots.size() - 1;
+            size_t hole = bucket(key);
+            while (m_slots[hole] != invalid && m_keys[hole] != key) hole = (hole + 1) & mask;
+            if (m_slots[hole] == invalid) return;
+
+            m_slots[hole] = invalid;
+            --m_count;
+
+            for (size_t i = (hole + 1) & mask; m_slots[i] != invalid; i = (i + 1) & mask) {
+                const size_t home = bucket(m_keys[i]);
+                if (((i - home) & mask) >= ((i - hole) & mask)) {
+                    m_keys[hole] = m_keys[i];
+                    m_slots[hole] = m_slots[i];
+                    m_slots[i] = invalid;
+                    hole = i;
+                }
+            }
+        }
+
+    private:
+        static uint64_t directLimit(const size_t count) { return std::max<uint64_t>(4096, uint64_t{4} * count); }
+
+        static size_t capacityFor(const size_t count) {
+            size_t capacity = 16;
+            while (capacity < count * 2) capacity *= 2;
+            return capacity;
+        }
+
+        size_t bucket(const uint64_t key) const {
+            uint64_t h = key * 0x9E3779B97F4A7C15ull;
+            h ^= h >> 32;
+            return static_cast<size_t>(h) & (m_slots.size() - 1);
+        }
+
+        void convertToHashed() {
+            std::vector<uint32_t> direct = std::move(m_direct);
+            m_direct.clear();
+            m_hashed = true;
+            m_count = 0;
+            m_keys.clear();
+            m_slots.clear();
+            rehash(capacityFor(direct.size() / 2 + 1));
+
+            for (uint64_t key = 0; key < direct.size(); ++key) {
+                if (direct[key] != invalid) insert(key, direct[key]);
+            }
+        }
+
+        void rehash(const size_t capacity) {
+            if (capacity <= m_slots.size()) return;
+
+            std::vector<uint64_t> keys = std::move(m_keys);
+            std::vector<uint32_t> slots = std::move(m_slots);
+            m_keys.assign(capacity, 0);
+            m_slots.assign(capacity, invalid);
+            m_count = 0;
+
+            for (size_t i = 0; i < slots.size(); ++i) {
+                if (slots[i] != invalid) insert(keys[i], slots[i]);
+            }
+        }
+
+        std::vector<uint32_t> m_direct;
+        std::vector<uint64_t> m_keys;
+        std::vector<uint32_t> m_slots;
+        size_t m_count = 0;
+        bool m_hashed = false;
+    };
+}
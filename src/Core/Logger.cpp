@@ -23,6 +23,7 @@
 
 namespace sfmeditor {
     std::deque<LogEntry> Logger::m_logs;
+    std::mutex Logger::m_mutex;
 
     const std::string kReset = "\033[0m";
     const std::string kRed = "\033[31m";
@@ -53,6 +54,7 @@ namespace sfmeditor {
     void Logger::log(LogLevel level, const std::string& message) {
         std::string timeStr = currentDateTime();
 
+        std::lock_guard lock(m_mutex);
         m_logs.emplace_back(level, message, timeStr);
         if (m_logs.size() > 100) m_logs.pop_front();
 
@@ -43,13 +43,20 @@ namespace sfmeditor {
         static void error(const std::string& message);
         static void critical(const std::string& message);
 
-        static const std::deque<LogEntry>& getLogs() { return m_logs; }
-        static void clear() { m_logs.clear(); }
+        static std::deque<LogEntry> getLogs() {
+            std::lock_guard lock(m_mutex);
+            return m_logs;
+        }
+        static void clear() {
+            std::lock_guard lock(m_mutex);
+            m_logs.clear();
+        }
 
     private:
         static void log(LogLevel level, const std::string& message);
         static std::string currentDateTime();
 
         static std::deque<LogEntry> m_logs;
+        static std::mutex m_mutex;
     };
 }
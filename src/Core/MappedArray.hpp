@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace sfmeditor {
+    // Read-mostly column that either owns its elements or views memory kept alive by an owner, such as a
+    // mapped scene cache. Writers go through values(), which first copies a viewed column into owned storage.
+    template <typename T>
+    class MappedArray {
+    public:
+        MappedArray() = default;
+        MappedArray(std::vector<T> values) : m_owned(std::move(values)) {}
+        MappedArray(const std::span<const T> view, std::shared_ptr<const void> owner)
+            : m_view(view), m_owner(std::move(owner)) {}
+
+        bool isMapped() const { return m_owner != nullptr; }
+
+        size_t size() const { return isMapped() ? m_view.size() : m_owned.size(); }
+        bool empty() const { return size() == 0; }
+
+        const T* data() const { return isMapped() ? m_view.data() : m_owned.data(); }
+        const T& operator[](const size_t index) const { return data()[index]; }
+        const T& front() const { return data()[0]; }
+        const T& back() const { return data()[size() - 1]; }
+        const T* begin() const { return data(); }
+        const T* end() const { return data() + size(); }
+        std::span<const T> span() const { return {data(), size()}; }
+
+        std::vector<T>& values() {
+            if (isMapped()) {
+                m_owned.assign(m_view.begin(), m_view.end());
+                m_view = {};
+                m_owner.reset();
+            }
+            return m_owned;
+        }
+
+        void clear() {
+            m_owned.clear();
+            m_view = {};
+            m_owner.reset();
+        }
+
+    private:
+        std::vector<T> m_owned;
+        std::span<const T> m_view;
+        std::shared_ptr<const void> m_owner;
+    };
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Parallel.hpp"
+
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cstdint>
+#include <vector>
+
+namespace sfmeditor {
+    // Spreads the low 21 bits of v so that two zero bits separate each of them.
+    inline uint64_t spreadMortonBits(uint64_t v) {
+        v &= 0x1fffff;
+        v = (v | v << 32) & 0x1f00000000ffffull;
+        v = (v | v << 16) & 0x1f0000ff0000ffull;
+        v = (v | v << 8) & 0x100f00f00f00f00full;
+        v = (v | v << 4) & 0x10c30c30c30c30c3ull;
+        v = (v | v << 2) & 0x1249249249249249ull;
+        return v;
+    }
+
+    inline uint64_t mortonCode(const glm::vec3& position, const glm::vec3& origin, const float scale) {
+        const glm::vec3 cell = glm::clamp((position - origin) * scale, glm::vec3(0.0f), glm::vec3(2097151.0f));
+        return spreadMortonBits(static_cast<uint64_t>(cell.x)) | spreadMortonBits(static_cast<uint64_t>(cell.y)) << 1 |
+            spreadMortonBits(static_cast<uint64_t>(cell.z)) << 2;
+    }
+
+    // Returns the point indices ordered along a Z-order curve over the cubic bounds of the cloud. The 63-bit
+    // codes are sorted by a stable LSD radix sort whose histogram and scatter steps run per chunk in parallel.
+    inline std::vector<uint32_t> mortonOrder(const std::vector<glm::vec3>& positions) {
+        const size_t count = positions.size();
+        std::vector<uint32_t> order(count);
+        if (count == 0) return order;
+
+        glm::vec3 minBound(FLT_MAX), maxBound(-FLT_MAX);
+        for (const glm::vec3& position : positions) {
+            minBound = glm::min(minBound, position);
+            maxBound = glm::max(maxBound, position);
+        }
+        const glm::vec3 extent = maxBound - minBound;
+        const float size = std::max({extent.x, extent.y, extent.z});
+        const float scale = size > 0.0f ? 2097151.0f / size : 0.0f;
+
+        std::vector<uint64_t> keys(count), keyScratch(count);
+        std::vector<uint32_t> orderScratch(count);
+        parallelFor(count, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                keys[i] = mortonCode(positions[i], minBound, scale);
+                order[i] = static_cast<uint32_t>(i);
+            }
+        });
+
+        constexpr size_t minChunkSize = 65536;
+        const size_t chunkCount = std::min(hardwareWorkerCount(), std::max<size_t>(1, count / minChunkSize));
+        const size_t chunkSize = (count + chunkCount - 1) / chunkCount;
+        std::vector<std::array<size_t, 256>> offsets(chunkCount);
+
+        for (uint32_t shift = 0; shift < 64; shift += 8) {
+            parallelFor(chunkCount, [&](const size_t firstChunk, const size_t endChunk) {
+                for (size_t chunk = firstChunk; chunk < endChunk; ++chunk) {
+                    offsets[chunk].fill(0);
+                    const size_t end = std::min(count, (chunk + 1) * chunkSize);
+                    for (size_t i = chunk * chunkSize; i < end; ++i) ++offsets[chunk][(keys[i] >> shift) & 0xff];
+                }
+            }, 1);
+
+            // Turn the per-chunk histograms into scatter offsets: digit-major, then chunk order for stability.
+            size_t running = 0;
+            bool skipPass = false;
+            for (size_t digit = 0; digit < 256; ++digit) {
+                size_t digitTotal = 0;
+                for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+                    const size_t bucket = offsets[chunk][digit];
+                    offsets[chunk][digit] = running;
+                    running += bucket;
+                    digitTotal += bucket;
+                }
+                if (digitTotal == count) skipPass = true;
+            }
+            if (skipPass) continue;
+
+            parallelFor(chunkCount, [&](const size_t firstChunk, const size_t endChunk) {
+                for (size_t chunk = firstChunk; chunk < endChunk; ++chunk) {
+                    std::array<size_t, 256>& cursors = offsets[chunk];
+                    const size_t end = std::min(count, (chunk + 1) * chunkSize);
+                    for (size_t i = chunk * chunkSize; i < end; ++i) {
+                        const size_t target = cursors[(keys[i] >> shift) & 0xff]++;
+                        keyScratch[target] = keys[i];
+                        orderScratch[target] = order[i];
+                    }
+                }
+            }, 1);
+            keys.swap(keyScratch);
+            order.swap(orderScratch);
+        }
+
+        return order;
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace sfmeditor {
+    inline size_t hardwareWorkerCount() {
+        const unsigned int count = std::thread::hardware_concurrency();
+        return count > 0 ? count : 1;
+    }
+
+    template <typename Fn>
+    void parallelFor(const size_t count, Fn&& fn, const size_t minChunkSize = 4096) {
+        if (count == 0) return;
+
+        const size_t workers = std::min(hardwareWorkerCount(), std::max<size_t>(1, count / minChunkSize));
+        if (workers <= 1) {
+            fn(size_t{0}, count);
+            return;
+        }
+
+        const size_t chunkSize = (count + workers - 1) / workers;
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+
+        for (size_t begin = chunkSize; begin < count; begin += chunkSize) {
+            const size_t end = std::min(begin + chunkSize, count);
+            threads.emplace_back([&fn, begin, end]() { fn(begin, end); });
+        }
+        fn(size_t{0}, std::min(chunkSize, count));
+
+        for (auto& thread : threads) thread.join();
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace sfmeditor {
+    enum PointFlags : uint8_t {
+        PointSelected = 1 << 0,
+        PointDeleted = 1 << 1,
+        PointHidden = 1 << 2,
+        PointIsolated = 1 << 3
+    };
+
+    // Interleaved static geometry consumed by the point shaders; the flags column is uploaded to its own buffer.
+    struct PointVertex {
+        glm::vec3 position;
+        glm::vec3 color;
+    };
+
+    // Structure-of-arrays point storage; loops that only need positions or flags touch only those columns.
+    struct PointCloud {
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec3> colors;
+        std::vector<uint8_t> flags;
+
+        size_t size() const { return positions.size(); }
+        bool empty() const { return positions.empty(); }
+
+        void clear() {
+            positions.clear();
+            colors.clear();
+            flags.clear();
+        }
+
+        void reserve(const size_t count) {
+            positions.reserve(count);
+            colors.reserve(count);
+            flags.reserve(count);
+        }
+
+        void resize(const size_t count) {
+            positions.resize(count);
+            colors.resize(count);
+            flags.resize(count, 0);
+        }
+
+        void push_back(const glm::vec3& position, const glm::vec3& color) {
+            positions.push_back(position);
+            colors.push_back(color);
+            flags.push_back(0);
+        }
+
+        void append(const PointCloud& other) {
+            positions.insert(positions.end(), other.positions.begin(), other.positions.end());
+            colors.insert(colors.end(), other.colors.begin(), other.colors.end());
+            flags.insert(flags.end(), other.flags.begin(), other.flags.end());
+        }
+
+        bool isSelected(const size_t i) const { return (flags[i] & PointSelected) != 0; }
+        bool isDeleted(const size_t i) const { return (flags[i] & PointDeleted) != 0; }
+        bool isVisible(const size_t i) const { return (flags[i] & (PointDeleted | PointHidden)) == 0; }
+
+        void setFlag(const size_t i, const uint8_t flag, const bool enabled) {
+            flags[i] = static_cast<uint8_t>(enabled ? (flags[i] | flag) : (flags[i] & ~flag));
+        }
+
+        PointVertex vertex(const size_t i) const {
+            return {positions[i], colors[i]};
+        }
+
+        void packVertices(const size_t begin, const size_t count, PointVertex* out) const {
+            for (size_t i = 0; i < count; ++i) out[i] = vertex(begin + i);
+        }
+    };
+}
@@ -18,6 +18,7 @@
 
 #include "EditorSystem.h"
 #include "Logger.h"
+#include "IO/PointStreamer.h"
 
 #include <algorithm>
 
@@ -28,16 +29,23 @@ namespace sfmeditor {
     }
 
     bool SelectionManager::hasSelection() const {
+        return !selectedPointIndices.empty() || !selectedImageIDs.empty() ||
+            (m_scene->streamedPoints && m_scene->streamedPoints->selectedCount() > 0);
+    }
+
+    bool SelectionManager::hasTransformableSelection() const {
         return !selectedPointIndices.empty() || !selectedImageIDs.empty();
     }
 
     void SelectionManager::clearSelection(const bool modifyScenePoints) {
         if (modifyScenePoints) {
             for (const unsigned int idx : selectedPointIndices) {
-                m_scene->points[idx].selected = 0.0f;
+                m_scene->points.setFlag(idx, PointSelected, false);
                 markAsChanged(idx);
             }
+            if (m_scene->streamedPoints) m_scene->streamedPoints->clearSelection();
         }
+        if (!selectedImageIDs.empty()) markCamerasChanged();
         selectedPointIndices.clear();
         selectedImageIDs.clear();
     }
@@ -45,16 +53,25 @@ namespace sfmeditor {
     void SelectionManager::selectAll(const bool selectPoints, const bool selectCameras) {
         if (selectPoints) {
             for (size_t i = 0; i < m_scene->points.size(); ++i) {
-                if (m_scene->points[i].selected < -0.5f) continue;
-                m_scene->points[i].selected = 1.0f;
+                if (!m_scene->points.isVisible(i)) continue;
+                m_scene->points.setFlag(i, PointSelected, true);
                 addPointToSelection(static_cast<unsigned int>(i));
                 markAsChanged(static_cast<unsigned int>(i));
             }
+
+            if (m_scene->streamedPoints) {
+                PointStreamer& streamer = *m_scene->streamedPoints;
+                streamer.forEachResident([&streamer](const uint32_t node, const PointCloud& nodePoints) {
+                    for (uint32_t i = 0; i < nodePoints.size(); ++i) {
+                        if (nodePoints.isVisible(i)) streamer.setSelected(node, i, true);
+                    }
+                });
+            }
         }
 
         if (selectCameras) {
-            for (const auto& [id, img] : m_scene->images) {
-                addImageToSelection(id);
+            for (const CameraPose& img : m_scene->images) {
+                addImageToSelection(img.imageID);
             }
         }
 
@@ -66,27 +83,49 @@ namespace sfmeditor {
         m_editorSystem->pendingPickedID = false;
         selectedPointIndices.clear();
         selectedImageIDs.clear();
-        changedIndices.clear();
+        changedRanges.clear();
+        movedRanges.clear();
+        markCamerasChanged();
     }
 
-    void SelectionManager::processPickedID(const int pickedID, const bool isCtrlPressed) {
+    void SelectionManager::processPickedID(const int64_t pickedIndex, const int64_t pickedNode,
+                                           const bool isCtrlPressed) {
         if (!isCtrlPressed) clearSelection();
 
-        if (pickedID < 0 || pickedID >= m_scene->points.size() || m_scene->points[pickedID].selected < -0.5f) {
+        if (pickedNode >= 0) {
+            processPickedStreamedPoint(static_cast<uint32_t>(pickedNode), pickedIndex, isCtrlPressed);
             return;
         }
 
-        if (isCtrlPressed && m_scene->points[pickedID].selected > 0.5f) {
-            m_scene->points[pickedID].selected = 0.0f;
+        if (pickedIndex < 0 || static_cast<uint64_t>(pickedIndex) >= m_scene->points.size()) return;
+        const auto pickedID = static_cast<uint32_t>(pickedIndex);
+        if (!m_scene->points.isVisible(pickedID)) return;
+
+        if (isCtrlPressed && m_scene->points.isSelected(pickedID)) {
+            m_scene->points.setFlag(pickedID, PointSelected, false);
             removePointFromSelection(pickedID);
-        } else if (m_scene->points[pickedID].selected < 0.5f) {
-            m_scene->points[pickedID].selected = 1.0f;
+        } else if (!m_scene->points.isSelected(pickedID)) {
+            m_scene->points.setFlag(pickedID, PointSelected, true);
             addPointToSelection(pickedID);
         }
         markAsChanged(pickedID);
         m_editorSystem->updateGizmoCenter();
     }
 
+    void SelectionManager::processPickedStreamedPoint(const uint32_t node, const int64_t pickedIndex,
+                                                      const bool isCtrlPressed) {
+        if (!m_scene->streamedPoints || node >= m_scene->streamedPoints->nodes().size()) return;
+        PointStreamer& streamer = *m_scene->streamedPoints;
+
+        // The node may have been evicted since it was drawn, in which case the click is dropped.
+        const PointCloud* nodePoints = streamer.acquire(node);
+        if (!nodePoints || pickedIndex < 0 || static_cast<uint64_t>(pickedIndex) >= nodePoints->size()) return;
+        const auto pickedID = static_cast<uint32_t>(pickedIndex);
+        if (!nodePoints->isVisible(pickedID)) return;
+
+        streamer.setSelected(node, pickedID, !(isCtrlPressed && nodePoints->isSelected(pickedID)));
+    }
+
     void SelectionManager::processBoxSelection(const glm::mat4& vpMatrix, const ViewportInfo& vpInfo,
                                                const glm::vec2& boxStart, const glm::vec2& boxEnd,
                                                const bool isCtrlPressed,
@@ -103,34 +142,42 @@ namespace sfmeditor {
         const auto rowW = glm::vec4(vpMatrix[0][3], vpMatrix[1][3], vpMatrix[2][3], vpMatrix[3][3]);
 
         if (allowPointSelection) {
-            for (unsigned int i = 0; i < m_scene->points.size(); ++i) {
-                if (m_scene->points[i].selected < -0.5f) continue;
-
-                const float w = glm::dot(rowW, glm::vec4(m_scene->points[i].position, 1.0f));
-                if (w <= 0.0f) continue;
-
-                const float x = glm::dot(rowX, glm::vec4(m_scene->points[i].position, 1.0f)) / w;
-                const float y = glm::dot(rowY, glm::vec4(m_scene->points[i].position, 1.0f)) / w;
-
-                if (x >= ndcMinX && x <= ndcMaxX && y >= ndcMinY && y <= ndcMaxY) {
-                    if (isCtrlPressed && m_scene->points[i].selected > 0.5f) {
-                        m_scene->points[i].selected = 0.0f;
-                    } else if (m_scene->points[i].selected < 0.5f) {
-                        m_scene->points[i].selected = 1.0f;
-                    }
-                    markAsChanged(i);
-                }
+            auto insideBox = [&](const glm::vec3& point) {
+                const glm::vec4 position(point, 1.0f);
+                const float w = glm::dot(rowW, position);
+                if (w <= 0.0f) return false;
+
+                const float x = glm::dot(rowX, position) / w;
+                const float y = glm::dot(rowY, position) / w;
+                return x >= ndcMinX && x <= ndcMaxX && y >= ndcMinY && y <= ndcMaxY;
+            };
+
+            PointCloud& points = m_scene->points;
+            for (unsigned int i = 0; i < points.size(); ++i) {
+                if (!points.isVisible(i) || !insideBox(points.positions[i])) continue;
+
+                const bool select = !(isCtrlPressed && points.isSelected(i));
+                points.setFlag(i, PointSelected, select);
+                if (select) addPointToSelection(i);
+                else removePointFromSelection(i);
+                markAsChanged(i);
             }
 
-
-            selectedPointIndices.clear();
-            for (unsigned int i = 0; i < m_scene->points.size(); ++i) {
-                if (m_scene->points[i].selected > 0.5f) addPointToSelection(i);
+            // Only nodes currently in memory can be edited; the rest of a streamed cloud is left untouched.
+            if (m_scene->streamedPoints) {
+                PointStreamer& streamer = *m_scene->streamedPoints;
+                streamer.forEachResident([&](const uint32_t node, const PointCloud& nodePoints) {
+                    for (uint32_t i = 0; i < nodePoints.size(); ++i) {
+                        if (!nodePoints.isVisible(i) || !insideBox(nodePoints.positions[i])) continue;
+                        streamer.setSelected(node, i, !(isCtrlPressed && nodePoints.isSelected(i)));
+                    }
+                });
             }
         }
 
         if (allowCameraSelection) {
-            for (const auto& [id, cam] : m_scene->images) {
+            for (const CameraPose& cam : m_scene->images) {
+                const uint32_t id = cam.imageID;
                 const float w = glm::dot(rowW, glm::vec4(cam.position, 1.0f));
                 if (w <= 0.0f) continue;
 
@@ -139,8 +186,7 @@ namespace sfmeditor {
 
                 if (x >= ndcMinX && x <= ndcMaxX && y >= ndcMinY && y <= ndcMaxY) {
                     if (isCtrlPressed) {
-                        auto it = std::find(selectedImageIDs.begin(), selectedImageIDs.end(), id);
-                        if (it != selectedImageIDs.end()) removeImageFromSelection(id);
+                        if (selectedImageIDs.contains(id)) removeImageFromSelection(id);
                         else addImageToSelection(id);
                     } else {
                         addImageToSelection(id);
@@ -153,39 +199,50 @@ namespace sfmeditor {
     }
 
     void SelectionManager::addPointToSelection(const unsigned int idx) {
-        if (std::find(selectedPointIndices.begin(), selectedPointIndices.end(), idx) == selectedPointIndices.end()) {
-            selectedPointIndices.push_back(idx);
-        }
+        selectedPointIndices.insert(idx);
     }
 
     void SelectionManager::removePointFromSelection(const unsigned int idx) {
-        std::erase(selectedPointIndices, idx);
+        selectedPointIndices.erase(idx);
     }
 
     void SelectionManager::addImageToSelection(const uint32_t id) {
-        if (std::find(selectedImageIDs.begin(), selectedImageIDs.end(), id) == selectedImageIDs.end()) {
-            selectedImageIDs.push_back(id);
-        }
+        selectedImageIDs.insert(id);
+        markCamerasChanged();
     }
 
     void SelectionManager::removeImageFromSelection(const uint32_t id) {
-        std::erase(selectedImageIDs, id);
+        selectedImageIDs.erase(id);
+        markCamerasChanged();
     }
 
     void SelectionManager::markAsChanged(const unsigned int idx) {
-        changedIndices.push_back(idx);
+        changedRanges.mark(idx);
+    }
+
+    void SelectionManager::markAllChanged() {
+        changedRanges.markAll(m_scene->points.size());
+    }
+
+    void SelectionManager::markCamerasChanged() {
+        ++cameraRevision;
+    }
+
+    void SelectionManager::markMoved(const unsigned int idx) {
+        movedRanges.mark(idx);
     }
 
     void SelectionManager::selectPointsByError(const double minError) {
         clearSelection();
         for (size_t i = 0; i < m_scene->points.size(); ++i) {
-            if (m_scene->points[i].selected < -0.5f) continue;
+            if (!m_scene->points.isVisible(i)) continue;
 
             if (i < m_scene->metadata.size() && m_scene->metadata[i].error > minError) {
-                m_scene->points[i].selected = 1.0f;
+                m_scene->points.setFlag(i, PointSelected, true);
                 addPointToSelection(static_cast<unsigned int>(i));
                 markAsChanged(static_cast<unsigned int>(i));
             }
+
         }
         m_editorSystem->updateGizmoCenter();
     }
@@ -193,13 +250,14 @@ namespace sfmeditor {
     void SelectionManager::selectPointsByTrackLength(const size_t maxTrackLength) {
         clearSelection();
         for (size_t i = 0; i < m_scene->points.size(); ++i) {
-            if (m_scene->points[i].selected < -0.5f) continue;
+            if (!m_scene->points.isVisible(i)) continue;
 
-            if (i < m_scene->metadata.size() && m_scene->metadata[i].observations.size() <= maxTrackLength) {
-                m_scene->points[i].selected = 1.0f;
+            if (i < m_scene->tracks.size() && m_scene->tracks.trackLength(i) <= maxTrackLength) {
+                m_scene->points.setFlag(i, PointSelected, true);
                 addPointToSelection(static_cast<unsigned int>(i));
                 markAsChanged(static_cast<unsigned int>(i));
             }
+
         }
         m_editorSystem->updateGizmoCenter();
     }
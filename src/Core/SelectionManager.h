@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "DirtyRanges.hpp"
+#include "SelectionSet.hpp"
 #include "Types.hpp"
 
 #include <vector>
@@ -29,11 +31,13 @@ namespace sfmeditor {
         SelectionManager(EditorSystem* editorSystem, SfMScene* scene);
 
         bool hasSelection() const;
+        // Streamed points can be selected and deleted but not moved, so they never bring up the gizmo.
+        bool hasTransformableSelection() const;
         void clearSelection(bool modifyScenePoints = true);
         void selectAll(bool selectPoints = true, bool selectCameras = true);
         void resetState();
 
-        void processPickedID(int pickedID, bool isCtrlPressed);
+        void processPickedID(int64_t pickedIndex, int64_t pickedNode, bool isCtrlPressed);
         void processBoxSelection(const glm::mat4& vpMatrix, const ViewportInfo& vpInfo, const glm::vec2& boxStart,
                                  const glm::vec2& boxEnd, bool isCtrlPressed, bool allowPointSelection,
                                  bool allowCameraSelection);
@@ -43,15 +47,22 @@ namespace sfmeditor {
         void addImageToSelection(uint32_t id);
         void removeImageFromSelection(uint32_t id);
         void markAsChanged(unsigned int idx);
+        void markAllChanged();
+        void markMoved(unsigned int idx);
+        void markCamerasChanged();
 
         void selectPointsByError(double minError);
         void selectPointsByTrackLength(size_t maxTrackLength);
 
-        std::vector<unsigned int> selectedPointIndices;
-        std::vector<uint32_t> selectedImageIDs;
-        std::vector<unsigned int> changedIndices;
+        SelectionSet selectedPointIndices;
+        SelectionSet selectedImageIDs;
+        DirtyRanges changedRanges;
+        DirtyRanges movedRanges;
+        uint64_t cameraRevision = 0;
 
     private:
+        void processPickedStreamedPoint(uint32_t node, int64_t pickedIndex, bool isCtrlPressed);
+
         EditorSystem* m_editorSystem;
         SfMScene* m_scene;
     };
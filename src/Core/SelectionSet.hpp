@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace sfmeditor {
+    // Set of dense 32-bit indices backed by a bitset. Membership, insert and erase are O(1); the sorted index
+    // list used for iteration is rebuilt from the bitset only when it is read after a modification.
+    class SelectionSet {
+    public:
+        using const_iterator = std::vector<uint32_t>::const_iterator;
+
+        bool contains(const uint32_t idx) const {
+            const size_t word = idx >> 6;
+            return word < m_words.size() && (m_words[word] >> (idx & 63) & 1) != 0;
+        }
+
+        bool insert(const uint32_t idx) {
+            const size_t word = idx >> 6;
+            if (word >= m_words.size()) m_words.resize(std::max(word + 1, m_words.size() * 2), 0);
+
+            const uint64_t bit = uint64_t(1) << (idx & 63);
+            if (m_words[word] & bit) return false;
+            m_words[word] |= bit;
+            m_firstWord = std::min(m_firstWord, word);
+            ++m_count;
+            m_indicesDirty = true;
+            return true;
+        }
+
+        bool erase(const uint32_t idx) {
+            const size_t word = idx >> 6;
+            if (word >= m_words.size()) return false;
+
+            const uint64_t bit = uint64_t(1) << (idx & 63);
+            if (!(m_words[word] & bit)) return false;
+            m_words[word] &= ~bit;
+            --m_count;
+            m_indicesDirty = true;
+            return true;
+        }
+
+        void clear() {
+            if (m_count == 0) return;
+            std::fill(m_words.begin(), m_words.end(), 0);
+            m_count = 0;
+            m_firstWord = m_words.size();
+            m_indices.clear();
+            m_indicesDirty = false;
+        }
+
+        void reserve(const size_t universe) {
+            if (universe > m_words.size() * 64) m_words.resize((universe + 63) / 64, 0);
+        }
+
+        size_t size() const { return m_count; }
+        bool empty() const { return m_count == 0; }
+
+        uint32_t front() const {
+            if (m_count == 0) return 0;
+            while (!m_words[m_firstWord]) ++m_firstWord;
+            return static_cast<uint32_t>(m_firstWord * 64 + std::countr_zero(m_words[m_firstWord]));
+        }
+
+        const std::vector<uint32_t>& indices() const {
+            if (m_indicesDirty) {
+                m_indices.clear();
+                m_indices.reserve(m_count);
+                for (size_t w = 0; w < m_words.size(); ++w) {
+                    for (uint64_t bits = m_words[w]; bits; bits &= bits - 1) {
+                        m_indices.push_back(static_cast<uint32_t>(w * 64 + std::countr_zero(bits)));
+                    }
+                }
+                m_indicesDirty = false;
+            }
+            return m_indices;
+        }
+
+        const_iterator begin() const { return indices().begin(); }
+        const_iterator end() const { return indices().end(); }
+
+    private:
+        std::vector<uint64_t> m_words;
+        size_t m_count = 0;
+        // No bit is set below this word. Inserts lower it and front() advances it, so repeated reads are O(1).
+        mutable size_t m_firstWord = 0;
+        mutable std::vector<uint32_t> m_indices;
+        mutable bool m_indicesDirty = false;
+    };
+}
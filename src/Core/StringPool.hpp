@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sfmeditor {
+    // Interns strings into large shared blocks; identical strings share one ID. Views stay valid for the
+    // lifetime of the pool.
+    class StringPool {
+    public:
+        static constexpr uint32_t invalid = UINT32_MAX;
+
+        void clear() {
+            m_blocks.clear();
+            m_strings.clear();
+            m_lookup.clear();
+            m_blockUsed = m_blockSize = 0;
+        }
+
+        void reserve(const size_t count) {
+            m_strings.reserve(count);
+            m_lookup.reserve(count);
+        }
+
+        size_t size() const { return m_strings.size(); }
+
+        uint32_t intern(const std::string_view text) {
+            if (const auto it = m_lookup.find(text); it != m_lookup.end()) return it->second;
+
+            const std::string_view stored = store(text);
+            const auto id = static_cast<uint32_t>(m_strings.size());
+            m_strings.push_back(stored);
+            m_lookup.emplace(stored, id);
+            return id;
+        }
+
+        std::string_view get(const uint32_t id) const {
+            return id < m_strings.size() ? m_strings[id] : std::string_view();
+        }
+
+    private:
+        static constexpr size_t blockSize = 1 << 16;
+
+        std::string_view store(const std::string_view text) {
+            if (text.empty()) return {};
+
+            if (m_blockUsed + text.size() > m_blockSize) {
+                m_blockSize = std::max(blockSize, text.size());
+                m_blocks.push_back(std::make_unique<char[]>(m_blockSize));
+                m_blockUsed = 0;
+            }
+            char* dst = m_blocks.back().get() + m_blockUsed;
+            std::memcpy(dst, text.data(), text.size());
+            m_blockUsed += text.size();
+            return {dst, text.size()};
+        }
+
+        std::vector<std::unique_ptr<char[]>> m_blocks;
+        std::vector<std::string_view> m_strings;
+        std::unordered_map<std::string_view, uint32_t> m_lookup;
+        size_t m_blockUsed = 0;
+        size_t m_blockSize = 0;
+    };
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "MappedArray.hpp"
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sfmeditor {
+    struct PointObservation {
+        uint32_t image_id;
+        uint32_t point2D_idx;
+    };
+
+    class TrackStore {
+    public:
+        void clear() {
+            m_offsets.clear();
+            m_observations.clear();
+        }
+
+        void reserve(const size_t pointCount, const size_t observationCount) {
+            m_offsets.values().reserve(pointCount + 1);
+            m_observations.values().reserve(observationCount);
+        }
+
+        void assign(MappedArray<uint64_t> offsets, MappedArray<PointObservation> observations) {
+            m_offsets = std::move(offsets);
+            m_observations = std::move(observations);
+        }
+
+        // Reorders the tracks so that track i becomes the former track order[i].
+        void permute(const std::span<const uint32_t> order) {
+            std::vector<uint64_t> offsets(order.size() + 1, 0);
+            for (size_t i = 0; i < order.size(); ++i) offsets[i + 1] = offsets[i] + trackLength(order[i]);
+
+            std::vector<PointObservation> observations(m_observations.size());
+            parallelFor(order.size(), [&](const size_t begin, const size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const std::span<const PointObservation> track = (*this)[order[i]];
+                    std::copy(track.begin(), track.end(),
+                              observations.begin() + static_cast<std::ptrdiff_t>(offsets[i]));
+                }
+            });
+
+            m_offsets = std::move(offsets);
+            m_observations = std::move(observations);
+        }
+
+        void append(const std::span<const PointObservation> track) {
+            std::vector<uint64_t>& offsets = m_offsets.values();
+            std::vector<PointObservation>& observations = m_observations.values();
+            if (offsets.empty()) offsets.push_back(0);
+            observations.insert(observations.end(), track.begin(), track.end());
+            offsets.push_back(observations.size());
+        }
+
+        size_t size() const { return m_offsets.empty() ? 0 : m_offsets.size() - 1; }
+        bool empty() const { return size() == 0; }
+
+        size_t trackLength(const size_t pointIndex) const {
+            return m_offsets[pointIndex + 1] - m_offsets[pointIndex];
+        }
+
+        std::span<const PointObservation> operator[](const size_t pointIndex) const {
+            return {m_observations.data() + m_offsets[pointIndex], trackLength(pointIndex)};
+        }
+
+        std::span<const uint64_t> offsets() const { return m_offsets.span(); }
+        std::span<const PointObservation> observations() const { return m_observations.span(); }
+
+    private:
+        MappedArray<uint64_t> m_offsets;
+        MappedArray<PointObservation> m_observations;
+    };
+}
@@ -16,14 +16,22 @@
 
 #pragma once
 
+#include "DenseTable.hpp"
+#include "FeatureStore.h"
+#include "PointCloud.hpp"
+#include "StringPool.hpp"
+#include "TrackStore.hpp"
+
 #include <glm/glm.hpp>
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/quaternion.hpp>
+#include <memory>
 #include <string>
 #include <vector>
-#include <unordered_map>
 
 namespace sfmeditor {
+    class PointStreamer;
+
     struct ViewportInfo {
         glm::vec2 size = {1.0f, 1.0f};
         glm::vec2 position = {0.0f, 0.0f};
@@ -31,26 +39,9 @@ namespace sfmeditor {
         bool hovered = false;
     };
 
-    struct Point {
-        glm::vec3 position;
-        glm::vec3 color;
-        float selected = 0.0f;
-    };
-
-    struct PointObservation {
-        uint32_t image_id;
-        uint32_t point2D_idx;
-    };
-
     struct PointMetadata {
         uint64_t original_id;
         double error = 0.0;
-        std::vector<PointObservation> observations;
-    };
-
-    struct Point2D {
-        glm::vec2 coordinates;
-        uint64_t point3D_id = static_cast<uint64_t>(-1);
     };
 
     struct Camera {
@@ -68,18 +59,23 @@ namespace sfmeditor {
     struct CameraPose {
         uint32_t imageID;
         uint32_t cameraID;
-        std::string imageName;
+        uint32_t nameId = StringPool::invalid;
         glm::vec3 position;
         glm::quat orientation;
-        std::vector<Point2D> features;
     };
 
     struct SfMScene {
         std::string imageBasePath;
-        std::vector<Point> points;
+        PointCloud points;
         std::vector<PointMetadata> metadata;
-        std::unordered_map<uint32_t, Camera> cameras;
-        std::unordered_map<uint32_t, CameraPose> images;
+        TrackStore tracks;
+        // Current index of the k-th point of the source file; empty when points are still in file order.
+        std::vector<uint32_t> loadOrder;
+        DenseTable<Camera> cameras;
+        DenseTable<CameraPose> images;
+        StringPool imageNames;
+        FeatureStore features;
+        std::shared_ptr<PointStreamer> streamedPoints;
     };
 
     struct SceneProperties {
@@ -90,6 +86,15 @@ namespace sfmeditor {
         bool showCameras = true;
         float pointSize = 6.0f;
         float cameraSize = 0.15f;
+        bool limitPointBudget = false;
+        int pointBudget = 10000000;
+        bool useSceneCache = true;
+        bool lazyFeatures = false;
+        bool spatialPointOrder = false;
+        bool compactPointFormat = false;
+        bool outOfCorePoints = false;
+        int streamingHostBudgetMB = 4096;
+        int streamingGpuBudgetMB = 1024;
     };
 
     struct Ray {
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace sfmeditor {
+    class BinaryReader {
+    public:
+        BinaryReader(const uint8_t* data, const size_t size)
+            : m_data(data), m_size(size) {
+        }
+
+        template <typename T>
+        bool read(T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            if (remaining() < sizeof(T)) return fail();
+            std::memcpy(&value, m_data + m_pos, sizeof(T));
+            m_pos += sizeof(T);
+            return true;
+        }
+
+        template <typename T>
+        bool readArray(T* dst, const size_t count) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const uint8_t* src = take(count, sizeof(T));
+            if (!src) return false;
+            if (count > 0) std::memcpy(dst, src, count * sizeof(T));
+            return true;
+        }
+
+        bool readString(std::string_view& out) {
+            const void* end = m_pos < m_size ? std::memchr(m_data + m_pos, '\0', m_size - m_pos) : nullptr;
+            if (!end) return fail();
+            const size_t length = static_cast<const uint8_t*>(end) - (m_data + m_pos);
+            out = {reinterpret_cast<const char*>(m_data + m_pos), length};
+            m_pos += length + 1;
+            return true;
+        }
+
+        const uint8_t* take(const size_t count, const size_t elementSize) {
+            if (elementSize != 0 && count > remaining() / elementSize) {
+                fail();
+                return nullptr;
+            }
+            const uint8_t* ptr = m_data + m_pos;
+            m_pos += count * elementSize;
+            return ptr;
+        }
+
+        bool skip(const size_t bytes) { return take(bytes, 1) != nullptr; }
+
+        void seek(const size_t position) { m_pos = position <= m_size ? position : m_size; }
+
+        size_t position() const { return m_pos; }
+        size_t remaining() const { return m_size - m_pos; }
+        bool ok() const { return m_ok; }
+
+    private:
+        bool fail() {
+            m_ok = false;
+            return false;
+        }
+
+        const uint8_t* m_data;
+        size_t m_size;
+        size_t m_pos = 0;
+        bool m_ok = true;
+    };
+}
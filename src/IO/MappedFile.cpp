@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace sfmeditor {
+    MappedFile::MappedFile(const std::string& filepath) {
+        open(filepath);
+    }
+
+    MappedFile::~MappedFile() {
+        close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept {
+        moveFrom(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    void MappedFile::moveFrom(MappedFile& other) {
+        m_data = other.m_data;
+        m_size = other.m_size;
+        m_isOpen = other.m_isOpen;
+#ifdef _WIN32
+        m_fileHandle = other.m_fileHandle;
+        m_mappingHandle = other.m_mappingHandle;
+        other.m_fileHandle = nullptr;
+        other.m_mappingHandle = nullptr;
+#else
+        m_fd = other.m_fd;
+        other.m_fd = -1;
+#endif
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_isOpen = false;
+    }
+
+    bool MappedFile::open(const std::string& filepath) {
+        close();
+
+#ifdef _WIN32
+        HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize)) {
+            CloseHandle(file);
+            return false;
+        }
+
+        m_fileHandle = file;
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+        m_isOpen = true;
+        if (m_size == 0) return true;
+
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            close();
+            return false;
+        }
+        m_mappingHandle = mapping;
+
+        m_data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_data) {
+            close();
+            return false;
+        }
+#else
+        const int fd = ::open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+
+        struct stat st{};
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+
+        m_fd = fd;
+        m_size = static_cast<size_t>(st.st_size);
+        m_isOpen = true;
+        if (m_size == 0) return true;
+
+        void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            close();
+            return false;
+        }
+        madvise(mapped, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const uint8_t*>(mapped);
+#endif
+        return true;
+    }
+
+    void MappedFile::close() {
+#ifdef _WIN32
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mappingHandle) CloseHandle(m_mappingHandle);
+        if (m_fileHandle) CloseHandle(m_fileHandle);
+        m_mappingHandle = nullptr;
+        m_fileHandle = nullptr;
+#else
+        if (m_data) munmap(const_cast<uint8_t*>(m_data), m_size);
+        if (m_fd >= 0) ::close(m_fd);
+        m_fd = -1;
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_isOpen = false;
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace sfmeditor {
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::string& filepath);
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        bool open(const std::string& filepath);
+        void close();
+
+        bool isOpen() const { return m_isOpen; }
+        const uint8_t* data() const { return m_data; }
+        size_t size() const { return m_size; }
+        std::string_view text() const { return {reinterpret_cast<const char*>(m_data), m_size}; }
+
+    private:
+        void moveFrom(MappedFile& other);
+
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        bool m_isOpen = false;
+
+#ifdef _WIN32
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+#else
+        int m_fd = -1;
+#endif
+    };
+}
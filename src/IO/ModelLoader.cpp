@@ -16,41 +16,669 @@
 
 #include "ModelLoader.h"
 
+#include "MappedFile.h"
+#include "BinaryReader.hpp"
+#include "TextParser.hpp"
+#include "PlyHeader.h"
+#include "PointNodeStore.h"
+#include "PointStreamer.h"
+#include "SceneCache.h"
 #include "Core/Logger.h"
+#include "Core/MortonOrder.hpp"
+#include "Core/Parallel.hpp"
 
-#include <fstream>
-#include <sstream>
 #include <filesystem>
-#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+#include <bit>
+#include <format>
+#include <future>
+#include <type_traits>
 
 namespace sfmeditor {
-    SfMScene ModelLoader::load(const std::string& filepath) {
+    namespace {
+#pragma pack(push, 1)
+        struct ColmapPoint3DHeader {
+            uint64_t id;
+            double xyz[3];
+            uint8_t rgb[3];
+            double error;
+            uint64_t trackLength;
+        };
+
+        struct ColmapImageHeader {
+            uint32_t imageID;
+            double qvec[4];
+            double tvec[3];
+            uint32_t cameraID;
+        };
+
+        struct ColmapPoint2D {
+            double x;
+            double y;
+            uint64_t point3D_id;
+        };
+#pragma pack(pop)
+
+        static_assert(sizeof(ColmapPoint3DHeader) == 51);
+        static_assert(sizeof(ColmapImageHeader) == 64);
+        static_assert(sizeof(ColmapPoint2D) == 24);
+        static_assert(sizeof(PointObservation) == 2 * sizeof(uint32_t));
+
+        size_t colmapNumParams(const int modelId) {
+            switch (modelId) {
+            case 0: return 3;
+            case 1:
+            case 2: return 4;
+            case 3:
+            case 6: return 5;
+            case 4: return 8;
+            case 5: return 12;
+            default: return 3;
+            }
+        }
+
+        constexpr size_t progressBatchSize = 1 << 16;
+        constexpr size_t lazyFeatureBudget = 1 << 22;
+        // Bounds for the chunks handed to a node store conversion.
+        constexpr size_t streamChunkPoints = 1 << 20;
+        constexpr size_t streamChunkBytes = 64 << 20;
+
+        void decodeColmapFeatures(const uint8_t* block, const uint64_t count, std::vector<glm::vec2>& outCoordinates,
+                                  std::vector<uint64_t>& outPointIds) {
+            outCoordinates.resize(count);
+            outPointIds.resize(count);
+            for (uint64_t i = 0; i < count; ++i) {
+                ColmapPoint2D raw;
+                std::memcpy(&raw, block + i * sizeof(ColmapPoint2D), sizeof(ColmapPoint2D));
+                outCoordinates[i] = glm::vec2(static_cast<float>(raw.x), static_cast<float>(raw.y));
+                outPointIds[i] = raw.point3D_id;
+            }
+        }
+
+        void readColmapFeatures(const std::string& imagesPath, const uint64_t fileOffset, const uint64_t count,
+                                std::vector<glm::vec2>& outCoordinates, std::vector<uint64_t>& outPointIds) {
+            std::vector<uint8_t> raw(count * sizeof(ColmapPoint2D));
+            std::ifstream file(imagesPath, std::ios::binary);
+            file.seekg(static_cast<std::streamoff>(fileOffset));
+            file.read(reinterpret_cast<char*>(raw.data()), static_cast<std::streamsize>(raw.size()));
+            if (!file) {
+                Logger::error("Failed to read image features from: " + imagesPath);
+                return;
+            }
+            decodeColmapFeatures(raw.data(), count, outCoordinates, outPointIds);
+        }
+
+        template <typename Fn>
+        void forEachBatch(const size_t begin, const size_t end, const LoadProgress& progress, Fn fn) {
+            for (size_t batchBegin = begin; batchBegin < end && !progress.isCancelled();
+                 batchBegin += progressBatchSize) {
+                fn(batchBegin, std::min(end, batchBegin + progressBatchSize));
+            }
+        }
+
+        std::string_view takeLines(const std::string_view text, size_t count) {
+            size_t pos = 0;
+            while (count > 0 && pos < text.size()) {
+                const void* newline = std::memchr(text.data() + pos, '\n', text.size() - pos);
+                if (!newline) return text;
+                pos = static_cast<const char*>(newline) - text.data() + 1;
+                --count;
+            }
+            return text.substr(0, pos);
+        }
+
+        template <typename ParseLine>
+        PointCloud parsePointLines(const std::string_view body, const size_t expectedCount, LoadProgress& progress,
+                                   ParseLine parseLine) {
+            constexpr size_t minChunkBytes = 1 << 20;
+            const size_t chunkCount = std::clamp<size_t>(body.size() / minChunkBytes, 1, hardwareWorkerCount() * 4);
+
+            std::vector<std::string_view> chunks;
+            chunks.reserve(chunkCount);
+            size_t chunkStart = 0;
+            for (size_t i = 1; i <= chunkCount && chunkStart < body.size(); ++i) {
+                size_t chunkEnd = body.size();
+                if (i < chunkCount) {
+                    chunkEnd = body.find('\n', std::max(chunkStart, body.size() * i / chunkCount));
+                    chunkEnd = (chunkEnd == std::string_view::npos) ? body.size() : chunkEnd + 1;
+                }
+                chunks.push_back(body.substr(chunkStart, chunkEnd - chunkStart));
+                chunkStart = chunkEnd;
+            }
+
+            std::vector<PointCloud> chunkPoints(chunks.size());
+            parallelFor(chunks.size(), [&](const size_t begin, const size_t end) {
+                for (size_t c = begin; c < end; ++c) {
+                    auto& out = chunkPoints[c];
+                    if (expectedCount > 0) out.reserve(expectedCount / chunks.size() + 1);
+
+                    LineReader lines(chunks[c]);
+                    std::string_view line;
+                    PointVertex p;
+                    size_t lineCount = 0, reportedBytes = 0, reportedPoints = 0;
+                    auto report = [&]() {
+                        progress.advance(lines.position() - reportedBytes);
+                        progress.publishPreview(out, reportedPoints, out.size() - reportedPoints);
+                        reportedBytes = lines.position();
+                        reportedPoints = out.size();
+                    };
+
+                    while (lines.next(line)) {
+                        if (parseLine(line, p)) out.push_back(p.position, p.color);
+                        if (++lineCount % progressBatchSize == 0) {
+                            if (progress.isCancelled()) return;
+                            report();
+                        }
+                    }
+                    report();
+                }
+            }, 1);
+
+            if (progress.isCancelled()) return {};
+
+            if (chunkPoints.size() == 1) return std::move(chunkPoints.front());
+
+            size_t total = 0;
+            for (const auto& chunk : chunkPoints) total += chunk.size();
+
+            PointCloud points;
+            points.reserve(std::max(total, expectedCount));
+            for (auto& chunk : chunkPoints) {
+                points.append(chunk);
+                chunk = PointCloud();
+            }
+            return points;
+        }
+
+        // Parses line-based point text a slice of whole lines at a time and hands every slice to the sink.
+        template <typename ParseLine>
+        bool streamPointLines(std::string_view body, LoadProgress& progress, ParseLine parseLine,
+                              const PointChunkSink& sink) {
+            while (!body.empty()) {
+                size_t sliceEnd = body.size();
+                if (sliceEnd > streamChunkBytes) {
+                    sliceEnd = body.find('\n', streamChunkBytes);
+                    sliceEnd = (sliceEnd == std::string_view::npos) ? body.size() : sliceEnd + 1;
+                }
+
+                const PointCloud chunk = parsePointLines(body.substr(0, sliceEnd), 0, progress, parseLine);
+                if (progress.isCancelled() || !sink(chunk)) return false;
+                body.remove_prefix(sliceEnd);
+            }
+            return true;
+        }
+
+        bool parseObjVertex(const std::string_view line, PointVertex& p) {
+            if (!line.starts_with("v ")) return false;
+
+            FieldParser fields(line.substr(2));
+            float x = 0.0f, y = 0.0f, z = 0.0f, r, g, b;
+            fields.nextAll(x, y, z);
+
+            p.position = {x, y, z};
+            if (fields.nextAll(r, g, b)) {
+                p.color = {r, g, b};
+            } else {
+                p.color = {1.0f, 1.0f, 1.0f};
+            }
+            return true;
+        }
+
+        bool parseXyzPoint(const std::string_view line, PointVertex& p) {
+            if (line.empty() || line[0] == '#') return false;
+
+            FieldParser fields(line);
+            float r, g, b;
+            if (!fields.nextAll(p.position.x, p.position.y, p.position.z, r, g, b)) return false;
+
+            p.color = {r / 255.0f, g / 255.0f, b / 255.0f};
+            return true;
+        }
+
+        // Position and color only; the error and track that follow on the line are skipped.
+        bool parseColmapPoint(const std::string_view line, PointVertex& p) {
+            if (line.empty() || line[0] == '#') return false;
+
+            FieldParser fields(line);
+            uint64_t id;
+            double x, y, z;
+            int r, g, b;
+            double error;
+            if (!fields.nextAll(id, x, y, z, r, g, b, error)) return false;
+
+            p.position = {static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)};
+            p.color = {r / 255.0f, g / 255.0f, b / 255.0f};
+            return true;
+        }
+
+        // COLMAP writes a "3D point" comment header; a .txt that starts with any other comment is read as XYZ.
+        bool isXyzText(const std::string_view text) {
+            LineReader lines(text);
+            std::string_view line;
+            return lines.next(line) && line.find('#') != std::string_view::npos &&
+                line.find("3D point") == std::string_view::npos;
+        }
+
+        struct PlyVertexLayout {
+            int position[3] = {-1, -1, -1};
+            int color[3] = {-1, -1, -1};
+            float colorScale = 1.0f;
+        };
+
+        bool resolvePlyVertexLayout(const PlyElement& vertex, PlyVertexLayout& layout) {
+            constexpr const char* colorNames[3][3] = {
+                {"red", "green", "blue"}, {"r", "g", "b"}, {"diffuse_red", "diffuse_green", "diffuse_blue"}
+            };
+
+            layout.position[0] = vertex.findProperty("x");
+            layout.position[1] = vertex.findProperty("y");
+            layout.position[2] = vertex.findProperty("z");
+
+            for (const auto& names : colorNames) {
+                for (int c = 0; c < 3; ++c) layout.color[c] = vertex.findProperty(names[c]);
+                if (layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0) break;
+            }
+
+            for (const int index : layout.position) {
+                if (index < 0 || vertex.properties[index].isList) return false;
+            }
+
+            if (layout.color[0] >= 0 && layout.color[1] >= 0 && layout.color[2] >= 0) {
+                const PlyScalarType colorType = vertex.properties[layout.color[0]].type;
+                if (colorType == PlyScalarType::UInt8) layout.colorScale = 1.0f / 255.0f;
+                else if (colorType == PlyScalarType::UInt16) layout.colorScale = 1.0f / 65535.0f;
+            } else {
+                layout.color[0] = layout.color[1] = layout.color[2] = -1;
+            }
+            return true;
+        }
+
+        std::string_view plyAsciiVertexLines(const std::string_view text, const PlyHeader& header,
+                                             const int vertexElement) {
+            const PlyElement& vertex = header.elements[vertexElement];
+            if (vertex.hasListProperty) {
+                Logger::warn("ASCII PLY vertex element has list properties; columns may be misread.");
+            }
+
+            size_t skippedLines = 0;
+            for (int i = 0; i < vertexElement; ++i) skippedLines += header.elements[i].count;
+
+            std::string_view body = text.substr(header.dataOffset);
+            body = body.substr(takeLines(body, skippedLines).size());
+            return takeLines(body, vertex.count);
+        }
+
+        auto plyAsciiLineParser(const PlyVertexLayout& layout) {
+            int lastColumn = 0;
+            for (int c = 0; c < 3; ++c) lastColumn = std::max({lastColumn, layout.position[c], layout.color[c]});
+            std::vector<int> columnRole(lastColumn + 1, -1);
+            for (int c = 0; c < 3; ++c) {
+                columnRole[layout.position[c]] = c;
+                if (layout.color[c] >= 0) columnRole[layout.color[c]] = c + 3;
+            }
+            const bool hasColor = layout.color[0] >= 0;
+
+            return [=](const std::string_view line, PointVertex& p) {
+                FieldParser fields(line);
+                float values[6] = {0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+                for (int column = 0; column <= lastColumn; ++column) {
+                    float value;
+                    if (!fields.next(value)) return false;
+                    if (columnRole[column] >= 0) values[columnRole[column]] = value;
+                }
+
+                p.position = {values[0], values[1], values[2]};
+                p.color = hasColor
+                              ? glm::vec3(values[3], values[4], values[5]) * layout.colorScale
+                              : glm::vec3(1.0f);
+                return true;
+            };
+        }
+
+        PointCloud decodePlyAscii(const std::string_view text, const PlyHeader& header, const int vertexElement,
+                                  const PlyVertexLayout& layout, LoadProgress& progress) {
+            return parsePointLines(plyAsciiVertexLines(text, header, vertexElement),
+                                   header.elements[vertexElement].count, progress, plyAsciiLineParser(layout));
+        }
+
+        using PlyScalarReader = float (*)(const uint8_t*);
+
+        template <typename T, bool Swap>
+        float readPlyScalar(const uint8_t* src) {
+            uint8_t bytes[sizeof(T)];
+            std::memcpy(bytes, src, sizeof(T));
+            if constexpr (Swap) std::reverse(std::begin(bytes), std::end(bytes));
+
+            T value;
+            std::memcpy(&value, bytes, sizeof(T));
+            return static_cast<float>(value);
+        }
+
+        template <bool Swap>
+        PlyScalarReader plyScalarReader(const PlyScalarType type) {
+            switch (type) {
+            case PlyScalarType::Int8: return &readPlyScalar<int8_t, false>;
+            case PlyScalarType::UInt8: return &readPlyScalar<uint8_t, false>;
+            case PlyScalarType::Int16: return &readPlyScalar<int16_t, Swap>;
+            case PlyScalarType::UInt16: return &readPlyScalar<uint16_t, Swap>;
+            case PlyScalarType::Int32: return &readPlyScalar<int32_t, Swap>;
+            case PlyScalarType::UInt32: return &readPlyScalar<uint32_t, Swap>;
+            case PlyScalarType::Float32: return &readPlyScalar<float, Swap>;
+            case PlyScalarType::Float64: return &readPlyScalar<double, Swap>;
+            default: return nullptr;
+            }
+        }
+
+        struct PlyBinaryVertices {
+            const uint8_t* base = nullptr;
+            size_t stride = 0;
+            size_t positionOffsets[3] = {};
+            size_t colorOffsets[3] = {};
+            float colorScale = 1.0f;
+        };
+
+        // Fixed scalar types let the common layouts decode without an indirect call per field.
+        template <typename Position, typename Color, bool Swap>
+        void decodePlyVertexRange(const PlyBinaryVertices& vertices, PointCloud& points, const size_t begin,
+                                  const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const uint8_t* v = vertices.base + i * vertices.stride;
+                points.positions[i] = {
+                    readPlyScalar<Position, Swap>(v + vertices.positionOffsets[0]),
+                    readPlyScalar<Position, Swap>(v + vertices.positionOffsets[1]),
+                    readPlyScalar<Position, Swap>(v + vertices.positionOffsets[2])
+                };
+                if constexpr (std::is_void_v<Color>) {
+                    points.colors[i] = glm::vec3(1.0f);
+                } else {
+                    points.colors[i] = glm::vec3(readPlyScalar<Color, Swap>(v + vertices.colorOffsets[0]),
+                                                 readPlyScalar<Color, Swap>(v + vertices.colorOffsets[1]),
+                                                 readPlyScalar<Color, Swap>(v + vertices.colorOffsets[2])) *
+                        vertices.colorScale;
+                }
+            }
+        }
+
+        using PlyRangeDecoder = void (*)(const PlyBinaryVertices&, PointCloud&, size_t, size_t);
+
+        // colorType is Invalid when the vertex has no color.
+        template <bool Swap>
+        PlyRangeDecoder plyRangeDecoder(const PlyScalarType positionType, const PlyScalarType colorType) {
+            if (positionType == PlyScalarType::Float32) {
+                if (colorType == PlyScalarType::UInt8) return &decodePlyVertexRange<float, uint8_t, Swap>;
+                if (colorType == PlyScalarType::Invalid) return &decodePlyVertexRange<float, void, Swap>;
+            } else if (positionType == PlyScalarType::Float64) {
+                if (colorType == PlyScalarType::UInt8) return &decodePlyVertexRange<double, uint8_t, Swap>;
+                if (colorType == PlyScalarType::Invalid) return &decodePlyVertexRange<double, void, Swap>;
+            }
+            return nullptr;
+        }
+
+        struct PlyBinaryDecoder {
+            PlyBinaryVertices vertices;
+            PlyRangeDecoder decodeRange = nullptr;
+            PlyScalarReader positionReaders[3] = {}, colorReaders[3] = {};
+            glm::vec3 colorScale{0.0f}, colorBias{1.0f};
+            size_t count = 0;
+
+            // Decodes vertices [first + begin, first + end) into points [begin, end).
+            void decode(PointCloud& points, const size_t first, const size_t begin, const size_t end) const {
+                PlyBinaryVertices range = vertices;
+                range.base += first * range.stride;
+                if (decodeRange) {
+                    decodeRange(range, points, begin, end);
+                    return;
+                }
+
+                for (size_t i = begin; i < end; ++i) {
+                    const uint8_t* v = range.base + i * range.stride;
+                    const size_t* positionOffsets = range.positionOffsets;
+                    const size_t* colorOffsets = range.colorOffsets;
+                    points.positions[i] = {
+                        positionReaders[0](v + positionOffsets[0]),
+                        positionReaders[1](v + positionOffsets[1]),
+                        positionReaders[2](v + positionOffsets[2])
+                    };
+                    points.colors[i] = glm::vec3(colorReaders[0](v + colorOffsets[0]),
+                                                 colorReaders[1](v + colorOffsets[1]),
+                                                 colorReaders[2](v + colorOffsets[2])) * colorScale + colorBias;
+                }
+            }
+        };
+
+        bool preparePlyBinary(const MappedFile& file, const PlyHeader& header, const int vertexElement,
+                              const PlyVertexLayout& layout, PlyBinaryDecoder& decoder) {
+            const PlyElement& vertex = header.elements[vertexElement];
+
+            size_t offset = 0;
+            if (vertex.hasListProperty || !header.elementOffset(vertexElement, offset)) {
+                Logger::error("Binary PLY with list properties before or inside the vertex element is unsupported.");
+                return false;
+            }
+            if (offset > file.size() || vertex.count > (file.size() - offset) / std::max<size_t>(vertex.stride, 1)) {
+                Logger::error("Binary PLY vertex data is truncated.");
+                return false;
+            }
+
+            const bool swap = (header.format == PlyFormat::BinaryBigEndian) !=
+                (std::endian::native == std::endian::big);
+            auto readerFor = [&](const int property) {
+                const PlyScalarType type = vertex.properties[property].type;
+                return swap ? plyScalarReader<true>(type) : plyScalarReader<false>(type);
+            };
+
+            PlyBinaryVertices& vertices = decoder.vertices;
+            vertices.base = file.data() + offset;
+            vertices.stride = vertex.stride;
+            vertices.colorScale = layout.colorScale;
+            decoder.count = vertex.count;
+
+            const bool hasColor = layout.color[0] >= 0;
+            for (int c = 0; c < 3; ++c) {
+                decoder.positionReaders[c] = readerFor(layout.position[c]);
+                vertices.positionOffsets[c] = vertex.properties[layout.position[c]].offset;
+                decoder.colorReaders[c] = hasColor ? readerFor(layout.color[c]) : decoder.positionReaders[c];
+                vertices.colorOffsets[c] = hasColor
+                                               ? vertex.properties[layout.color[c]].offset
+                                               : vertices.positionOffsets[c];
+            }
+
+            auto sharedType = [&](const int (&properties)[3]) {
+                const PlyScalarType type = vertex.properties[properties[0]].type;
+                const bool shared = vertex.properties[properties[1]].type == type &&
+                    vertex.properties[properties[2]].type == type;
+                return shared ? type : PlyScalarType::Invalid;
+            };
+            const PlyScalarType positionType = sharedType(layout.position);
+            const PlyScalarType colorType = hasColor ? sharedType(layout.color) : PlyScalarType::Invalid;
+            if (!hasColor || colorType != PlyScalarType::Invalid) {
+                decoder.decodeRange = swap
+                                          ? plyRangeDecoder<true>(positionType, colorType)
+                                          : plyRangeDecoder<false>(positionType, colorType);
+            }
+
+            decoder.colorScale = hasColor ? glm::vec3(layout.colorScale) : glm::vec3(0.0f);
+            decoder.colorBias = hasColor ? glm::vec3(0.0f) : glm::vec3(1.0f);
+            return true;
+        }
+
+        PointCloud decodePlyBinary(const MappedFile& file, const PlyHeader& header, const int vertexElement,
+                                   const PlyVertexLayout& layout, LoadProgress& progress) {
+            PlyBinaryDecoder decoder;
+            if (!preparePlyBinary(file, header, vertexElement, layout, decoder)) return {};
+
+            PointCloud points;
+            points.resize(decoder.count);
+
+            parallelFor(points.size(), [&](const size_t begin, const size_t end) {
+                forEachBatch(begin, end, progress, [&](const size_t batchBegin, const size_t batchEnd) {
+                    decoder.decode(points, 0, batchBegin, batchEnd);
+                    progress.advance((batchEnd - batchBegin) * decoder.vertices.stride);
+                    progress.publishPreview(points, batchBegin, batchEnd - batchBegin);
+                });
+            });
+
+            if (progress.isCancelled()) return {};
+            return points;
+        }
+
+        void logThroughput(const std::string& label, const size_t bytes,
+                           const std::chrono::steady_clock::time_point startTime) {
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            const double megabytes = static_cast<double>(bytes) / (1024.0 * 1024.0);
+            Logger::info(std::format("Decoded {} ({:.1f} MB) in {:.0f} ms ({:.1f} MB/s).", label, megabytes,
+                                     seconds * 1000.0, seconds > 0.0 ? megabytes / seconds : 0.0));
+        }
+    }
+
+    void LoadProgress::begin(const uint64_t totalBytes) {
+        m_totalBytes.store(totalBytes, std::memory_order_relaxed);
+        m_processedBytes.store(0, std::memory_order_relaxed);
+    }
+
+    float LoadProgress::fraction() const {
+        const uint64_t total = m_totalBytes.load(std::memory_order_relaxed);
+        if (total == 0) return 0.0f;
+        return std::min(1.0f, static_cast<float>(m_processedBytes.load(std::memory_order_relaxed)) /
+                        static_cast<float>(total));
+    }
+
+    void LoadProgress::enablePreview(const size_t pointBudget) {
+        std::lock_guard lock(m_previewMutex);
+        m_previewBudget = pointBudget;
+    }
+
+    void LoadProgress::publishPreview(const PointCloud& points, const size_t begin, const size_t count) {
+        if (count == 0) return;
+
+        std::lock_guard lock(m_previewMutex);
+        const size_t accepted = std::min(count, m_previewBudget);
+        const size_t previewEnd = m_previewPoints.size();
+        m_previewPoints.resize(previewEnd + accepted);
+        points.packVertices(begin, accepted, m_previewPoints.data() + previewEnd);
+        m_previewBudget -= accepted;
+    }
+
+    bool LoadProgress::takePreview(std::vector<PointVertex>& outPoints) {
+        outPoints.clear();
+
+        std::lock_guard lock(m_previewMutex);
+        if (m_previewPoints.empty()) return false;
+        outPoints.swap(m_previewPoints);
+        return true;
+    }
+
+    SfMScene ModelLoader::load(const std::string& filepath, const LoadOptions& options, LoadProgress* progress) {
         std::filesystem::path path = std::filesystem::weakly_canonical(filepath);
         const std::string ext = path.extension().string();
 
         Logger::info("Loading file: " + path.string());
 
+        LoadProgress localProgress;
+        LoadProgress& loadProgress = progress ? *progress : localProgress;
+
         SfMScene scene;
-        bool isColmap = false;
+        const bool isColmap = ext == ".bin" || ext == ".txt";
+        // A node store replaces the points entirely, so neither the cache nor the point file is loaded. A missing
+        // one is built by streaming the point file in chunks; if that fails the points are loaded in memory.
+        bool streamPoints = options.outOfCore && PointNodeStore::isCurrent(path.string());
+        if (options.outOfCore && !streamPoints) {
+            std::error_code ec;
+            loadProgress.begin(std::filesystem::file_size(path, ec));
+            streamPoints = PointNodeStore::convert(path.string(), [&](const PointChunkSink& sink) {
+                return readPointChunks(path.string(), loadProgress, sink);
+            });
+            if (loadProgress.isCancelled()) {
+                Logger::warn("Loading cancelled: " + path.string());
+                return SfMScene{};
+            }
+        }
+        const bool fromCache = !streamPoints && options.useSceneCache &&
+            SceneCache::load(path.string(), options, scene, loadProgress);
 
-        if (ext == ".bin") {
-            scene = loadColmapBinary(path.string());
-            loadColmapCameras(path.parent_path().string(), scene);
-            isColmap = true;
-        } else if (ext == ".txt") {
-            scene = loadColmapText(path.string());
-            loadColmapCamerasText(path.parent_path().string(), scene);
-            isColmap = true;
-        } else if (ext == ".ply") {
-            scene = loadPLY(path.string());
-        } else if (ext == ".obj") {
-            scene = loadOBJ(path.string());
-        } else if (ext == ".xyz") {
-            scene = loadXYZ(path.string());
+        if (fromCache) {
+            Logger::info(std::format("Loaded {} points, {} cameras and {} images from scene cache.",
+                                     scene.points.size(), scene.cameras.size(), scene.images.size()));
+        } else if (isColmap) {
+            const bool isBinary = ext == ".bin";
+            const std::string directory = path.parent_path().string();
+
+            uint64_t totalBytes = 0;
+            for (const char* name : {"points3D", "cameras", "images"}) {
+                if (streamPoints && std::string_view(name) == "points3D") continue;
+                std::error_code ec;
+                const uint64_t size = std::filesystem::file_size(path.parent_path() / (name + ext), ec);
+                if (!ec) totalBytes += size;
+            }
+            loadProgress.begin(totalBytes);
+
+            auto camerasTask = std::async(std::launch::async, [&directory, isBinary, &loadProgress]() {
+                return isBinary
+                           ? loadColmapCameras(directory, loadProgress)
+                           : loadColmapCamerasText(directory, loadProgress);
+            });
+            FeatureStore features;
+            StringPool imageNames;
+            auto imagesTask = std::async(std::launch::async, [&directory, isBinary, &options, &features,
+                                             &imageNames, &loadProgress]() {
+                return isBinary
+                           ? loadColmapImages(directory, options.lazyFeatures, imageNames, features, loadProgress)
+                           : loadColmapImagesText(directory, imageNames, features, loadProgress);
+            });
+
+            if (!streamPoints) {
+                scene = isBinary
+                            ? loadColmapBinary(path.string(), loadProgress)
+                            : loadColmapText(path.string(), loadProgress);
+            }
+            scene.cameras = camerasTask.get();
+            scene.images = imagesTask.get();
+            scene.imageNames = std::move(imageNames);
+            scene.features = std::move(features);
+            resolveFeaturePoints(scene);
+
+            Logger::info(std::format("Loaded {} intrinsic cameras and {} images (poses).", scene.cameras.size(),
+                                     scene.images.size()));
+        } else if (streamPoints) {
+            Logger::info("Using point node store: " + PointNodeStore::storePath(path.string()));
+        } else if (ext == ".ply" || ext == ".obj" || ext == ".xyz") {
+            std::error_code ec;
+            loadProgress.begin(std::filesystem::file_size(path, ec));
+
+            if (ext == ".ply") scene = loadPLY(path.string(), loadProgress);
+            else if (ext == ".obj") scene = loadOBJ(path.string(), loadProgress);
+            else scene = loadXYZ(path.string(), loadProgress);
         } else {
             Logger::error("Unsupported format: " + ext);
         }
 
+        if (loadProgress.isCancelled()) {
+            Logger::warn("Loading cancelled: " + path.string());
+            return SfMScene{};
+        }
+
+        if (options.useSceneCache && !fromCache && !scene.points.empty()) {
+            SceneCache::save(path.string(), options, scene);
+        }
+
+        if (options.spatialOrder && !streamPoints && scene.points.size() > 1) {
+            sortPointsSpatially(scene);
+        }
+
+        if (streamPoints) {
+            auto streamer = std::make_shared<PointStreamer>();
+            if (streamer->open(PointNodeStore::storePath(path.string()), options.streamingHostBudget)) {
+                scene.points = PointCloud{};
+                scene.metadata = std::vector<PointMetadata>{};
+                scene.tracks = TrackStore{};
+                scene.streamedPoints = std::move(streamer);
+            }
+        }
+
         if (isColmap) {
             std::filesystem::path currentDir = path.parent_path();
             bool foundImages = false;
@@ -79,302 +707,502 @@ namespace sfmeditor {
         return scene;
     }
 
-    SfMScene ModelLoader::loadColmapBinary(const std::string& filepath) {
-        std::ifstream file(filepath, std::ios::binary);
-        if (!file) return SfMScene{};
+    SfMScene ModelLoader::loadColmapBinary(const std::string& filepath, LoadProgress& progress) {
+        const MappedFile file(filepath);
+        if (!file.isOpen()) return SfMScene{};
+
+        const auto startTime = std::chrono::steady_clock::now();
+        BinaryReader reader(file.data(), file.size());
 
         uint64_t numPoints = 0;
-        file.read(reinterpret_cast<char*>(&numPoints), sizeof(uint64_t));
+        reader.read(numPoints);
+        if (numPoints > reader.remaining() / sizeof(ColmapPoint3DHeader)) {
+            Logger::error("Truncated or corrupt COLMAP file: " + filepath);
+            return SfMScene{};
+        }
+
+        // Phase 1: records are variable length, so walk only the track lengths to find where each one starts.
+        std::vector<size_t> recordOffsets(numPoints);
+        std::vector<uint64_t> trackOffsets(numPoints + 1, 0);
+        for (uint64_t i = 0; i < numPoints; ++i) {
+            if (i % (progressBatchSize * 16) == 0 && progress.isCancelled()) return SfMScene{};
+            recordOffsets[i] = reader.position();
 
+            uint64_t trackLength = 0;
+            if (!reader.skip(offsetof(ColmapPoint3DHeader, trackLength)) || !reader.read(trackLength) ||
+                !reader.take(trackLength, sizeof(PointObservation))) {
+                Logger::error("Truncated or corrupt COLMAP file: " + filepath);
+                return SfMScene{};
+            }
+            trackOffsets[i + 1] = trackOffsets[i] + trackLength;
+        }
+
+        // Phase 2: every record is now independently addressable and in bounds.
         SfMScene scene;
-        scene.points.reserve(numPoints);
-        scene.metadata.reserve(numPoints);
+        scene.points.resize(numPoints);
+        scene.metadata.resize(numPoints);
+        std::vector<PointObservation> observations(trackOffsets.back());
 
-        for (uint64_t i = 0; i < numPoints; ++i) {
-            uint64_t id;
-            double xyz[3];
-            uint8_t rgb[3];
-            double error;
-            uint64_t trackLength;
+        parallelFor(numPoints, [&](const size_t begin, const size_t end) {
+            forEachBatch(begin, end, progress, [&](const size_t batchBegin, const size_t batchEnd) {
+                for (size_t i = batchBegin; i < batchEnd; ++i) {
+                    const uint8_t* record = file.data() + recordOffsets[i];
+                    ColmapPoint3DHeader header;
+                    std::memcpy(&header, record, sizeof(ColmapPoint3DHeader));
 
-            file.read(reinterpret_cast<char*>(&id), sizeof(uint64_t));
-            file.read(reinterpret_cast<char*>(xyz), 3 * sizeof(double));
-            file.read(reinterpret_cast<char*>(rgb), 3 * sizeof(uint8_t));
-            file.read(reinterpret_cast<char*>(&error), sizeof(double));
-            file.read(reinterpret_cast<char*>(&trackLength), sizeof(uint64_t));
+                    scene.points.positions[i] = {
+                        static_cast<float>(header.xyz[0]), static_cast<float>(header.xyz[1]),
+                        static_cast<float>(header.xyz[2])
+                    };
+                    scene.points.colors[i] = {header.rgb[0] / 255.0f, header.rgb[1] / 255.0f, header.rgb[2] / 255.0f};
 
-            scene.points.push_back({
-                {static_cast<float>(xyz[0]), static_cast<float>(xyz[1]), static_cast<float>(xyz[2])},
-                {rgb[0] / 255.0f, rgb[1] / 255.0f, rgb[2] / 255.0f}, 0.0f
+                    scene.metadata[i] = {header.id, header.error};
+                    std::memcpy(observations.data() + trackOffsets[i], record + sizeof(ColmapPoint3DHeader),
+                                header.trackLength * sizeof(PointObservation));
+                }
+
+                const size_t batchEndOffset = (batchEnd < numPoints) ? recordOffsets[batchEnd] : reader.position();
+                progress.advance(batchEndOffset - recordOffsets[batchBegin]);
+                progress.publishPreview(scene.points, batchBegin, batchEnd - batchBegin);
             });
+        });
 
-            PointMetadata meta{id, error};
-            meta.observations.reserve(trackLength);
-            for (uint64_t j = 0; j < trackLength; ++j) {
-                uint32_t image_id, point2D_idx;
-                file.read(reinterpret_cast<char*>(&image_id), sizeof(uint32_t));
-                file.read(reinterpret_cast<char*>(&point2D_idx), sizeof(uint32_t));
-                meta.observations.push_back({image_id, point2D_idx});
-            }
-            scene.metadata.push_back(std::move(meta));
-        }
+        if (progress.isCancelled()) return SfMScene{};
+        scene.tracks.assign(std::move(trackOffsets), std::move(observations));
+
+        logThroughput("points3D.bin", file.size(), startTime);
         return scene;
     }
 
-    SfMScene ModelLoader::loadColmapText(const std::string& filepath) {
-        std::ifstream file(filepath);
-        std::string line;
+    SfMScene ModelLoader::loadColmapText(const std::string& filepath, LoadProgress& progress) {
+        const MappedFile file(filepath);
+        if (!file.isOpen()) return SfMScene{};
 
-        std::getline(file, line);
-        if (line.find("#") != std::string::npos && line.find("3D point") == std::string::npos) {
-            return loadXYZ(filepath);
-        }
+        const auto startTime = std::chrono::steady_clock::now();
+        if (isXyzText(file.text())) return loadXYZ(filepath, progress);
 
-        file.clear();
-        file.seekg(0);
+        LineReader lines(file.text());
+        std::string_view line;
         SfMScene scene;
+        std::vector<PointObservation> track;
+        size_t lineCount = 0, reportedBytes = 0, reportedPoints = 0;
+        auto report = [&]() {
+            progress.advance(lines.position() - reportedBytes);
+            progress.publishPreview(scene.points, reportedPoints, scene.points.size() - reportedPoints);
+            reportedBytes = lines.position();
+            reportedPoints = scene.points.size();
+        };
 
-        while (std::getline(file, line)) {
+        while (lines.next(line)) {
+            if (++lineCount % progressBatchSize == 0) {
+                if (progress.isCancelled()) return SfMScene{};
+                report();
+            }
             if (line.empty() || line[0] == '#') continue;
 
-            std::stringstream ss(line);
+            FieldParser fields(line);
             uint64_t id;
             double x, y, z;
             int r, g, b;
             double error;
 
-            if (ss >> id >> x >> y >> z >> r >> g >> b >> error) {
-                scene.points.push_back({
-                    {static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)},
-                    {r / 255.0f, g / 255.0f, b / 255.0f}, 0.0f
-                });
+            if (fields.nextAll(id, x, y, z, r, g, b, error)) {
+                scene.points.push_back({static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)},
+                                       {r / 255.0f, g / 255.0f, b / 255.0f});
+
+                scene.metadata.push_back({id, error});
 
-                PointMetadata meta{id, error};
+                track.clear();
                 uint32_t img_id, pt2d_idx;
-                while (ss >> img_id >> pt2d_idx) {
-                    meta.observations.push_back({img_id, pt2d_idx});
+                while (fields.nextAll(img_id, pt2d_idx)) {
+                    track.push_back({img_id, pt2d_idx});
                 }
-                scene.metadata.push_back(std::move(meta));
+                scene.tracks.append(track);
             }
         }
+        report();
+
+        logThroughput("points3D.txt", file.size(), startTime);
         return scene;
     }
 
-    void ModelLoader::loadColmapCameras(const std::string& directory, SfMScene& scene) {
-        std::ifstream camFile((std::filesystem::path(directory) / "cameras.bin").string(), std::ios::binary);
-        if (camFile) {
-            uint64_t numCameras;
-            camFile.read(reinterpret_cast<char*>(&numCameras), sizeof(uint64_t));
-
-            for (uint64_t i = 0; i < numCameras; ++i) {
-                Camera cam;
-                camFile.read(reinterpret_cast<char*>(&cam.cameraID), sizeof(uint32_t));
-                camFile.read(reinterpret_cast<char*>(&cam.modelId), sizeof(int));
-                camFile.read(reinterpret_cast<char*>(&cam.width), sizeof(uint64_t));
-                camFile.read(reinterpret_cast<char*>(&cam.height), sizeof(uint64_t));
-
-                size_t numParams = 0;
-                switch (cam.modelId) {
-                case 0: numParams = 3;
-                    break;
-                case 1:
-                case 2: numParams = 4;
-                    break;
-                case 3:
-                case 6: numParams = 5;
-                    break;
-                case 4: numParams = 8;
-                    break;
-                case 5: numParams = 12;
+    bool ModelLoader::readPointChunks(const std::string& filepath, LoadProgress& progress,
+                                      const PointChunkSink& sink) {
+        const MappedFile file(filepath);
+        if (!file.isOpen()) return false;
+
+        const auto startTime = std::chrono::steady_clock::now();
+        const std::string ext = std::filesystem::path(filepath).extension().string();
+        bool ok = false;
+
+        if (ext == ".ply") {
+            PlyHeader header;
+            PlyVertexLayout layout;
+            const int vertexElement = PlyHeader::parse(file.text(), header) ? header.findElement("vertex") : -1;
+            if (vertexElement < 0 || !resolvePlyVertexLayout(header.elements[vertexElement], layout)) {
+                Logger::error("PLY file has no vertex element with x/y/z properties: " + filepath);
+                return false;
+            }
+
+            if (header.format == PlyFormat::Ascii) {
+                ok = streamPointLines(plyAsciiVertexLines(file.text(), header, vertexElement), progress,
+                                      plyAsciiLineParser(layout), sink);
+            } else {
+                PlyBinaryDecoder decoder;
+                ok = preparePlyBinary(file, header, vertexElement, layout, decoder);
+
+                PointCloud chunk;
+                for (size_t first = 0; ok && first < decoder.count; first += streamChunkPoints) {
+                    chunk.resize(std::min(streamChunkPoints, decoder.count - first));
+                    parallelFor(chunk.size(), [&](const size_t begin, const size_t end) {
+                        forEachBatch(begin, end, progress, [&](const size_t batchBegin, const size_t batchEnd) {
+                            decoder.decode(chunk, first, batchBegin, batchEnd);
+                            progress.advance((batchEnd - batchBegin) * decoder.vertices.stride);
+                        });
+                    });
+                    progress.publishPreview(chunk, 0, chunk.size());
+                    ok = !progress.isCancelled() && sink(chunk);
+                }
+            }
+        } else if (ext == ".obj") {
+            ok = streamPointLines(file.text(), progress, parseObjVertex, sink);
+        } else if (ext == ".xyz" || (ext == ".txt" && isXyzText(file.text()))) {
+            ok = streamPointLines(file.text(), progress, parseXyzPoint, sink);
+        } else if (ext == ".txt") {
+            ok = streamPointLines(file.text(), progress, parseColmapPoint, sink);
+        } else if (ext == ".bin") {
+            BinaryReader reader(file.data(), file.size());
+            uint64_t numPoints = 0;
+            reader.read(numPoints);
+            if (numPoints > reader.remaining() / sizeof(ColmapPoint3DHeader)) {
+                Logger::error("Truncated or corrupt COLMAP file: " + filepath);
+                return false;
+            }
+
+            // Records are variable length, so they are walked in order; tracks are skipped, not copied.
+            PointCloud chunk;
+            chunk.reserve(std::min<uint64_t>(numPoints, streamChunkPoints));
+            size_t reportedBytes = 0;
+            ok = true;
+            for (uint64_t i = 0; ok && i < numPoints; ++i) {
+                ColmapPoint3DHeader header;
+                if (!reader.readArray(&header, 1) || !reader.take(header.trackLength, sizeof(PointObservation))) {
+                    ok = false;
                     break;
-                default: numParams = 3;
                 }
-                cam.extraParams.resize(numParams);
-                camFile.read(reinterpret_cast<char*>(cam.extraParams.data()), numParams * sizeof(double));
-                computeCameraIntrinsics(cam);
-                scene.cameras[cam.cameraID] = std::move(cam);
+                const glm::vec3 position(header.xyz[0], header.xyz[1], header.xyz[2]);
+                chunk.push_back(position, {header.rgb[0] / 255.0f, header.rgb[1] / 255.0f, header.rgb[2] / 255.0f});
+
+                if (chunk.size() == streamChunkPoints || i + 1 == numPoints) {
+                    progress.advance(reader.position() - reportedBytes);
+                    progress.publishPreview(chunk, 0, chunk.size());
+                    reportedBytes = reader.position();
+                    ok = !progress.isCancelled() && sink(chunk);
+                    chunk.clear();
+                }
             }
+            if (!reader.ok()) Logger::error("Truncated or corrupt COLMAP file: " + filepath);
+        } else {
+            Logger::error("Unsupported format: " + ext);
         }
 
-        std::ifstream imgFile((std::filesystem::path(directory) / "images.bin").string(), std::ios::binary);
-        if (!imgFile) return;
+        if (ok) logThroughput(std::filesystem::path(filepath).filename().string(), file.size(), startTime);
+        return ok;
+    }
+
+    DenseTable<Camera> ModelLoader::loadColmapCameras(const std::string& directory, LoadProgress& progress) {
+        DenseTable<Camera> cameras;
+
+        const MappedFile camFile((std::filesystem::path(directory) / "cameras.bin").string());
+        if (!camFile.isOpen()) return cameras;
+
+        const auto startTime = std::chrono::steady_clock::now();
+        BinaryReader reader(camFile.data(), camFile.size());
+
+        uint64_t numCameras = 0;
+        reader.read(numCameras);
+
+        for (uint64_t i = 0; i < numCameras; ++i) {
+            Camera cam;
+            reader.read(cam.cameraID);
+            reader.read(cam.modelId);
+            reader.read(cam.width);
+            reader.read(cam.height);
+
+            cam.extraParams.resize(colmapNumParams(cam.modelId));
+            if (!reader.readArray(cam.extraParams.data(), cam.extraParams.size())) {
+                Logger::error("Truncated COLMAP cameras.bin in: " + directory);
+                break;
+            }
+            computeCameraIntrinsics(cam);
+            cameras.insert(cam.cameraID, std::move(cam));
+        }
+
+        progress.advance(camFile.size());
+        logThroughput("cameras.bin", camFile.size(), startTime);
+        return cameras;
+    }
+
+    void ModelLoader::attachColmapFeatureSource(FeatureStore& features, const std::string& imagesPath) {
+        features.setLazySource(imagesPath, [imagesPath](const uint64_t fileOffset, const uint64_t count,
+                                                        std::vector<glm::vec2>& outCoordinates,
+                                                        std::vector<uint64_t>& outPointIds) {
+            readColmapFeatures(imagesPath, fileOffset, count, outCoordinates, outPointIds);
+        }, lazyFeatureBudget);
+    }
+
+    void ModelLoader::resolveFeaturePoints(SfMScene& scene) {
+        auto pointSlots = std::make_shared<IdIndex>();
+        pointSlots->reserve(scene.metadata.size());
+        for (size_t i = 0; i < scene.metadata.size(); ++i) {
+            pointSlots->insert(scene.metadata[i].original_id, static_cast<uint32_t>(i));
+        }
+        scene.features.resolvePoints(std::move(pointSlots));
+    }
+
+    void ModelLoader::sortPointsSpatially(SfMScene& scene) {
+        if (scene.points.size() > UINT32_MAX) return;
+        const auto startTime = std::chrono::steady_clock::now();
+
+        const std::vector<uint32_t> order = mortonOrder(scene.points.positions);
+        const size_t count = order.size();
+        const bool hasMetadata = scene.metadata.size() == count;
 
-        uint64_t numImages;
-        imgFile.read(reinterpret_cast<char*>(&numImages), sizeof(uint64_t));
+        PointCloud points;
+        points.resize(count);
+        std::vector<PointMetadata> metadata(hasMetadata ? count : 0);
+        scene.loadOrder.resize(count);
+        parallelFor(count, [&](const size_t begin, const size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const uint32_t source = order[i];
+                points.positions[i] = scene.points.positions[source];
+                points.colors[i] = scene.points.colors[source];
+                points.flags[i] = scene.points.flags[source];
+                if (hasMetadata) metadata[i] = scene.metadata[source];
+                scene.loadOrder[source] = static_cast<uint32_t>(i);
+            }
+        });
+
+        scene.points = std::move(points);
+        if (hasMetadata) scene.metadata = std::move(metadata);
+        if (scene.tracks.size() == count) scene.tracks.permute(order);
+
+        scene.features.remapPoints(scene.loadOrder);
+        if (scene.features.isLazy()) resolveFeaturePoints(scene);
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        Logger::info(std::format("Sorted {} points along a Morton curve in {:.0f} ms.", count, seconds * 1000.0));
+    }
+
+    DenseTable<CameraPose> ModelLoader::loadColmapImages(const std::string& directory, const bool lazyFeatures,
+                                                         StringPool& outNames, FeatureStore& outFeatures,
+                                                         LoadProgress& progress) {
+        DenseTable<CameraPose> images;
+
+        const std::string imagesPath = (std::filesystem::path(directory) / "images.bin").string();
+        const MappedFile imgFile(imagesPath);
+        if (!imgFile.isOpen()) return images;
+        if (lazyFeatures) attachColmapFeatureSource(outFeatures, imagesPath);
+
+        const auto startTime = std::chrono::steady_clock::now();
+        BinaryReader reader(imgFile.data(), imgFile.size());
+
+        uint64_t numImages = 0;
+        reader.read(numImages);
+        const size_t imageCapacity = std::min<uint64_t>(numImages, reader.remaining() / sizeof(ColmapImageHeader));
+        images.reserve(imageCapacity);
+        outNames.reserve(imageCapacity);
 
+        std::vector<glm::vec2> coordinates;
+        std::vector<uint64_t> pointIds;
+        if (!lazyFeatures) outFeatures.reserve(imageCapacity, reader.remaining() / sizeof(ColmapPoint2D));
+
+        size_t reportedBytes = 0;
         for (uint64_t i = 0; i < numImages; ++i) {
+            if (progress.isCancelled()) return {};
+            progress.advance(reader.position() - reportedBytes);
+            reportedBytes = reader.position();
+
             CameraPose img;
-            double qw, qx, qy, qz, tx, ty, tz;
+            ColmapImageHeader header;
+            std::string_view imageName;
+            uint64_t numPoints2D = 0;
 
-            imgFile.read(reinterpret_cast<char*>(&img.imageID), sizeof(uint32_t));
-            imgFile.read(reinterpret_cast<char*>(&qw), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&qx), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&qy), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&qz), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&tx), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&ty), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&tz), sizeof(double));
-            imgFile.read(reinterpret_cast<char*>(&img.cameraID), sizeof(uint32_t));
+            if (!reader.readArray(&header, 1) || !reader.readString(imageName) || !reader.read(numPoints2D)) break;
 
-            char c;
-            while (imgFile.read(&c, 1) && c != '\0') { img.imageName += c; }
+            const size_t featureOffset = reader.position();
+            const uint8_t* block = reader.take(numPoints2D, sizeof(ColmapPoint2D));
+            if (!block) break;
 
-            uint64_t numPoints2D;
-            imgFile.read(reinterpret_cast<char*>(&numPoints2D), sizeof(uint64_t));
-            img.features.resize(numPoints2D);
+            img.imageID = header.imageID;
+            img.cameraID = header.cameraID;
+            img.nameId = outNames.intern(imageName);
 
-            for (uint64_t j = 0; j < numPoints2D; ++j) {
-                double x, y;
-                uint64_t point3D_id;
-                imgFile.read(reinterpret_cast<char*>(&x), sizeof(double));
-                imgFile.read(reinterpret_cast<char*>(&y), sizeof(double));
-                imgFile.read(reinterpret_cast<char*>(&point3D_id), sizeof(uint64_t));
-                img.features[j] = {glm::vec2(static_cast<float>(x), static_cast<float>(y)), point3D_id};
+            if (lazyFeatures) {
+                outFeatures.setLazy(img.imageID, featureOffset, numPoints2D);
+            } else {
+                decodeColmapFeatures(block, numPoints2D, coordinates, pointIds);
+                outFeatures.append(img.imageID, coordinates, pointIds);
             }
 
-            computeCameraExtrinsics(img, qw, qx, qy, qz, tx, ty, tz);
-            scene.images[img.imageID] = std::move(img);
+            const double* q = header.qvec;
+            const double* t = header.tvec;
+            computeCameraExtrinsics(img, q[0], q[1], q[2], q[3], t[0], t[1], t[2]);
+            images.insert(img.imageID, img);
         }
-        Logger::info(std::format("Loaded {} intrinsic cameras and {} images (poses).", scene.cameras.size(),
-                                 scene.images.size()));
+
+        if (!reader.ok()) {
+            Logger::error("Truncated or corrupt COLMAP images.bin in: " + directory);
+        }
+
+        progress.advance(imgFile.size() - reportedBytes);
+        logThroughput("images.bin", imgFile.size(), startTime);
+        return images;
     }
 
-    void ModelLoader::loadColmapCamerasText(const std::string& directory, SfMScene& scene) {
-        std::ifstream camFile((std::filesystem::path(directory) / "cameras.txt").string());
-        if (camFile) {
-            std::string line;
-            while (std::getline(camFile, line)) {
-                if (line.empty() || line[0] == '#') continue;
-                std::stringstream ss(line);
-                uint32_t cam_id;
-                std::string modelStr;
-                uint64_t width, height;
-
-                if (ss >> cam_id >> modelStr >> width >> height) {
-                    Camera cam{cam_id, 0, width, height};
-                    if (modelStr == "SIMPLE_PINHOLE") cam.modelId = 0;
-                    else if (modelStr == "PINHOLE") cam.modelId = 1;
-                    else if (modelStr == "SIMPLE_RADIAL") cam.modelId = 2;
-                    else if (modelStr == "RADIAL") cam.modelId = 3;
-                    else if (modelStr == "OPENCV") cam.modelId = 4;
-                    else if (modelStr == "OPENCV_FISHEYE") cam.modelId = 5;
-                    else if (modelStr == "FULL_OPENCV") cam.modelId = 6;
-
-                    double param;
-                    while (ss >> param) cam.extraParams.push_back(param);
-                    computeCameraIntrinsics(cam);
-                    scene.cameras[cam_id] = cam;
-                }
+    DenseTable<Camera> ModelLoader::loadColmapCamerasText(const std::string& directory, LoadProgress& progress) {
+        DenseTable<Camera> cameras;
+
+        const MappedFile camFile((std::filesystem::path(directory) / "cameras.txt").string());
+        if (!camFile.isOpen()) return cameras;
+
+        LineReader lines(camFile.text());
+        std::string_view line;
+
+        while (lines.next(line)) {
+            if (line.empty() || line[0] == '#') continue;
+
+            FieldParser fields(line);
+            uint32_t cam_id;
+            std::string_view modelStr;
+            uint64_t width, height;
+
+            if (fields.nextAll(cam_id, modelStr, width, height)) {
+                Camera cam{cam_id, 0, width, height};
+                if (modelStr == "SIMPLE_PINHOLE") cam.modelId = 0;
+                else if (modelStr == "PINHOLE") cam.modelId = 1;
+                else if (modelStr == "SIMPLE_RADIAL") cam.modelId = 2;
+                else if (modelStr == "RADIAL") cam.modelId = 3;
+                else if (modelStr == "OPENCV") cam.modelId = 4;
+                else if (modelStr == "OPENCV_FISHEYE") cam.modelId = 5;
+                else if (modelStr == "FULL_OPENCV") cam.modelId = 6;
+
+                double param;
+                while (fields.next(param)) cam.extraParams.push_back(param);
+                computeCameraIntrinsics(cam);
+                cameras.insert(cam_id, std::move(cam));
             }
         }
 
-        std::ifstream imgFile((std::filesystem::path(directory) / "images.txt").string());
-        if (!imgFile) return;
+        progress.advance(camFile.size());
+        return cameras;
+    }
+
+    DenseTable<CameraPose> ModelLoader::loadColmapImagesText(const std::string& directory, StringPool& outNames,
+                                                             FeatureStore& outFeatures, LoadProgress& progress) {
+        DenseTable<CameraPose> images;
+
+        const MappedFile imgFile((std::filesystem::path(directory) / "images.txt").string());
+        if (!imgFile.isOpen()) return images;
+
+        const auto startTime = std::chrono::steady_clock::now();
+        LineReader lines(imgFile.text());
+        std::string_view poseLine, featureLine;
+        std::vector<glm::vec2> coordinates;
+        std::vector<uint64_t> pointIds;
 
-        std::string line1, line2;
-        while (std::getline(imgFile, line1) && std::getline(imgFile, line2)) {
-            if (line1.empty() || line1[0] == '#') continue;
+        size_t reportedBytes = 0;
+        while (lines.next(poseLine)) {
+            if (progress.isCancelled()) return {};
+            progress.advance(lines.position() - reportedBytes);
+            reportedBytes = lines.position();
 
-            std::stringstream ss1(line1);
+            if (poseLine.empty() || poseLine[0] == '#') continue;
+            if (!lines.next(featureLine)) featureLine = {};
+
+            FieldParser poseFields(poseLine);
             CameraPose img;
             double qw, qx, qy, qz, tx, ty, tz;
+            std::string_view imageName;
+
+            if (poseFields.nextAll(img.imageID, qw, qx, qy, qz, tx, ty, tz, img.cameraID, imageName)) {
+                img.nameId = outNames.intern(imageName);
 
-            if (ss1 >> img.imageID >> qw >> qx >> qy >> qz >> tx >> ty >> tz >> img.cameraID >> img.imageName) {
-                std::stringstream ss2(line2);
+                FieldParser featureFields(featureLine);
                 double x, y;
-                long long point3D_id_raw;
+                int64_t point3D_id_raw;
+                coordinates.clear();
+                pointIds.clear();
 
-                while (ss2 >> x >> y >> point3D_id_raw) {
-                    uint64_t p3d = (point3D_id_raw < 0)
-                                       ? static_cast<uint64_t>(-1)
-                                       : static_cast<uint64_t>(point3D_id_raw);
-                    img.features.push_back({glm::vec2(static_cast<float>(x), static_cast<float>(y)), p3d});
+                while (featureFields.nextAll(x, y, point3D_id_raw)) {
+                    coordinates.emplace_back(static_cast<float>(x), static_cast<float>(y));
+                    pointIds.push_back(point3D_id_raw < 0 ? static_cast<uint64_t>(-1)
+                                                          : static_cast<uint64_t>(point3D_id_raw));
                 }
+                outFeatures.append(img.imageID, coordinates, pointIds);
                 computeCameraExtrinsics(img, qw, qx, qy, qz, tx, ty, tz);
-                scene.images[img.imageID] = std::move(img);
+                images.insert(img.imageID, img);
             }
         }
-        Logger::info(std::format("Loaded {} intrinsic cameras and {} images (poses).", scene.cameras.size(),
-                                 scene.images.size()));
+
+        progress.advance(imgFile.size() - reportedBytes);
+        logThroughput("images.txt", imgFile.size(), startTime);
+        return images;
     }
 
-    SfMScene ModelLoader::loadPLY(const std::string& filepath) {
+    SfMScene ModelLoader::loadPLY(const std::string& filepath, LoadProgress& progress) {
         SfMScene scene;
-        std::ifstream in(filepath);
-        std::string line;
-        bool headerEnded = false;
-        int vertexCount = 0;
-
-        while (std::getline(in, line)) {
-            if (line.find("element vertex") != std::string::npos) {
-                std::stringstream ss(line);
-                std::string temp;
-                ss >> temp >> temp >> vertexCount;
-                scene.points.reserve(vertexCount);
-            }
-            if (line == "end_header") {
-                headerEnded = true;
-                continue;
-            }
-            if (!headerEnded) continue;
-
-            std::stringstream ss(line);
-            float x, y, z, r, g, b;
-            if (ss >> x >> y >> z >> r >> g >> b) {
-                Point p;
-                p.position = {x, y, z};
-                if (r > 1.0f || g > 1.0f || b > 1.0f) {
-                    p.color = {r / 255.0f, g / 255.0f, b / 255.0f};
-                } else {
-                    p.color = {r, g, b};
-                }
-                scene.points.push_back(p);
-            }
+        const MappedFile file(filepath);
+        if (!file.isOpen()) return scene;
+
+        const auto startTime = std::chrono::steady_clock::now();
+
+        PlyHeader header;
+        if (!PlyHeader::parse(file.text(), header)) {
+            Logger::error("Invalid PLY header: " + filepath);
+            return scene;
         }
+
+        const int vertexElement = header.findElement("vertex");
+        PlyVertexLayout layout;
+        if (vertexElement < 0 || !resolvePlyVertexLayout(header.elements[vertexElement], layout)) {
+            Logger::error("PLY file has no vertex element with x/y/z properties: " + filepath);
+            return scene;
+        }
+
+        if (header.format == PlyFormat::Ascii) {
+            scene.points = decodePlyAscii(file.text(), header, vertexElement, layout, progress);
+        } else {
+            scene.points = decodePlyBinary(file, header, vertexElement, layout, progress);
+        }
+
+        logThroughput("PLY", file.size(), startTime);
         return scene;
     }
 
-    SfMScene ModelLoader::loadOBJ(const std::string& filepath) {
+    SfMScene ModelLoader::loadOBJ(const std::string& filepath, LoadProgress& progress) {
         SfMScene scene;
-        std::ifstream in(filepath);
-        std::string line;
+        const MappedFile file(filepath);
+        if (!file.isOpen()) return scene;
 
-        while (std::getline(in, line)) {
-            if (line.substr(0, 2) == "v ") {
-                std::stringstream ss(line.substr(2));
-                float x, y, z, r, g, b;
-                ss >> x >> y >> z;
+        const auto startTime = std::chrono::steady_clock::now();
 
-                Point p;
-                p.position = {x, y, z};
+        scene.points = parsePointLines(file.text(), 0, progress, parseObjVertex);
 
-                if (ss >> r >> g >> b) {
-                    p.color = {r, g, b};
-                } else {
-                    p.color = {1.0f, 1.0f, 1.0f};
-                }
-                scene.points.push_back(p);
-            }
-        }
+        logThroughput("OBJ", file.size(), startTime);
         return scene;
     }
 
-    SfMScene ModelLoader::loadXYZ(const std::string& filepath) {
+    SfMScene ModelLoader::loadXYZ(const std::string& filepath, LoadProgress& progress) {
         SfMScene scene;
-        std::ifstream in(filepath);
-        std::string line;
+        const MappedFile file(filepath);
+        if (!file.isOpen()) return scene;
 
-        while (std::getline(in, line)) {
-            if (line.empty() || line[0] == '#') continue;
+        const auto startTime = std::chrono::steady_clock::now();
 
-            std::stringstream ss(line);
-            float r, g, b;
-            Point p;
-            if (ss >> p.position.x >> p.position.y >> p.position.z >> r >> g >> b) {
-                p.color = {r / 255.0f, g / 255.0f, b / 255.0f};
-                scene.points.push_back(p);
-            }
-        }
+        scene.points = parsePointLines(file.text(), 0, progress, parseXyzPoint);
+
+        logThroughput("XYZ", file.size(), startTime);
         return scene;
     }
 
@@ -17,24 +17,73 @@
 #pragma once
 
 #include "Core/Types.hpp"
+#include "PointNodeStore.h"
 
 #include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
 
 namespace sfmeditor {
+    class LoadProgress {
+    public:
+        void begin(uint64_t totalBytes);
+        void advance(uint64_t bytes) { m_processedBytes.fetch_add(bytes, std::memory_order_relaxed); }
+        float fraction() const;
+
+        void cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+        bool isCancelled() const { return m_cancelled.load(std::memory_order_relaxed); }
+
+        void enablePreview(size_t pointBudget);
+        void publishPreview(const PointCloud& points, size_t begin, size_t count);
+        bool takePreview(std::vector<PointVertex>& outPoints);
+
+    private:
+        std::atomic<uint64_t> m_processedBytes = 0;
+        std::atomic<uint64_t> m_totalBytes = 0;
+        std::atomic<bool> m_cancelled = false;
+
+        std::mutex m_previewMutex;
+        std::vector<PointVertex> m_previewPoints;
+        size_t m_previewBudget = 0;
+    };
+
+    struct LoadOptions {
+        bool useSceneCache = true;
+        bool lazyFeatures = false;
+        bool spatialOrder = false;
+        bool outOfCore = false;
+        size_t streamingHostBudget = 0;
+    };
+
     class ModelLoader {
     public:
-        static SfMScene load(const std::string& filepath);
+        static SfMScene load(const std::string& filepath, const LoadOptions& options = {},
+                             LoadProgress* progress = nullptr);
+
+        static void attachColmapFeatureSource(FeatureStore& features, const std::string& imagesPath);
+        static void resolveFeaturePoints(SfMScene& scene);
+        static void sortPointsSpatially(SfMScene& scene);
 
     private:
-        static SfMScene loadColmapBinary(const std::string& filepath);
-        static SfMScene loadColmapText(const std::string& filepath);
+        static SfMScene loadColmapBinary(const std::string& filepath, LoadProgress& progress);
+        static SfMScene loadColmapText(const std::string& filepath, LoadProgress& progress);
+
+        static DenseTable<Camera> loadColmapCameras(const std::string& directory, LoadProgress& progress);
+        static DenseTable<CameraPose> loadColmapImages(const std::string& directory, bool lazyFeatures,
+                                                       StringPool& outNames, FeatureStore& outFeatures,
+                                                       LoadProgress& progress);
+        static DenseTable<Camera> loadColmapCamerasText(const std::string& directory, LoadProgress& progress);
+        static DenseTable<CameraPose> loadColmapImagesText(const std::string& directory, StringPool& outNames,
+                                                           FeatureStore& outFeatures, LoadProgress& progress);
 
-        static void loadColmapCameras(const std::string& directory, SfMScene& scene);
-        static void loadColmapCamerasText(const std::string& directory, SfMScene& scene);
+        static SfMScene loadPLY(const std::string& filepath, LoadProgress& progress);
+        static SfMScene loadOBJ(const std::string& filepath, LoadProgress& progress);
+        static SfMScene loadXYZ(const std::string& filepath, LoadProgress& progress);
 
-        static SfMScene loadPLY(const std::string& filepath);
-        static SfMScene loadOBJ(const std::string& filepath);
-        static SfMScene loadXYZ(const std::string& filepath);
+        // Reads only positions and colors, a bounded chunk at a time, so a node store can be built from files
+        // that do not fit in memory.
+        static bool readPointChunks(const std::string& filepath, LoadProgress& progress, const PointChunkSink& sink);
 
         static void computeCameraExtrinsics(CameraPose& cam, double qw, double qx, double qy, double qz, double tx,
                                             double ty, double tz);
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PlyHeader.h"
+
+#include "TextParser.hpp"
+
+namespace sfmeditor {
+    size_t plyScalarSize(const PlyScalarType type) {
+        switch (type) {
+        case PlyScalarType::Int8:
+        case PlyScalarType::UInt8: return 1;
+        case PlyScalarType::Int16:
+        case PlyScalarType::UInt16: return 2;
+        case PlyScalarType::Int32:
+        case PlyScalarType::UInt32:
+        case PlyScalarType::Float32: return 4;
+        case PlyScalarType::Float64: return 8;
+        default: return 0;
+        }
+    }
+
+    PlyScalarType plyScalarTypeFromName(const std::string_view name) {
+        if (name == "char" || name == "int8") return PlyScalarType::Int8;
+        if (name == "uchar" || name == "uint8") return PlyScalarType::UInt8;
+        if (name == "short" || name == "int16") return PlyScalarType::Int16;
+        if (name == "ushort" || name == "uint16") return PlyScalarType::UInt16;
+        if (name == "int" || name == "int32") return PlyScalarType::Int32;
+        if (name == "uint" || name == "uint32") return PlyScalarType::UInt32;
+        if (name == "float" || name == "float32") return PlyScalarType::Float32;
+        if (name == "double" || name == "float64") return PlyScalarType::Float64;
+        return PlyScalarType::Invalid;
+    }
+
+    int PlyElement::findProperty(const std::string_view propertyName) const {
+        for (size_t i = 0; i < properties.size(); ++i) {
+            if (properties[i].name == propertyName) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    int PlyHeader::findElement(const std::string_view elementName) const {
+        for (size_t i = 0; i < elements.size(); ++i) {
+            if (elements[i].name == elementName) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    bool PlyHeader::elementOffset(const size_t elementIndex, size_t& outOffset) const {
+        outOffset = dataOffset;
+        for (size_t i = 0; i < elementIndex; ++i) {
+            if (elements[i].hasListProperty) return false;
+            outOffset += elements[i].count * elements[i].stride;
+        }
+        return true;
+    }
+
+    bool PlyHeader::parse(const std::string_view text, PlyHeader& outHeader) {
+        outHeader = PlyHeader{};
+
+        LineReader lines(text);
+        std::string_view line;
+        if (!lines.next(line) || line != "ply") return false;
+
+        bool hasFormat = false;
+        while (lines.next(line)) {
+            FieldParser fields(line);
+            std::string_view keyword;
+            if (!fields.next(keyword)) continue;
+
+            if (keyword == "format") {
+                std::string_view formatName;
+                fields.next(formatName);
+                if (formatName == "ascii") outHeader.format = PlyFormat::Ascii;
+                else if (formatName == "binary_little_endian") outHeader.format = PlyFormat::BinaryLittleEndian;
+                else if (formatName == "binary_big_endian") outHeader.format = PlyFormat::BinaryBigEndian;
+                else return false;
+                hasFormat = true;
+            } else if (keyword == "element") {
+                PlyElement element;
+                std::string_view name;
+                if (!fields.nextAll(name, element.count)) return false;
+                element.name.assign(name);
+                outHeader.elements.push_back(std::move(element));
+            } else if (keyword == "property") {
+                if (outHeader.elements.empty()) return false;
+                PlyElement& element = outHeader.elements.back();
+
+                PlyProperty property;
+                std::string_view typeName, name;
+                if (!fields.next(typeName)) return false;
+
+                if (typeName == "list") {
+                    std::string_view countTypeName;
+                    if (!fields.nextAll(countTypeName, typeName)) return false;
+                    property.isList = true;
+                    property.listCountType = plyScalarTypeFromName(countTypeName);
+                    element.hasListProperty = true;
+                }
+                property.type = plyScalarTypeFromName(typeName);
+                if (property.type == PlyScalarType::Invalid || !fields.next(name)) return false;
+
+                property.name.assign(name);
+                property.offset = element.stride;
+                if (!property.isList) element.stride += plyScalarSize(property.type);
+                element.properties.push_back(std::move(property));
+            } else if (keyword == "end_header") {
+                outHeader.dataOffset = lines.position();
+                return hasFormat;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sfmeditor {
+    enum class PlyFormat {
+        Ascii,
+        BinaryLittleEndian,
+        BinaryBigEndian
+    };
+
+    enum class PlyScalarType {
+        Invalid,
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Float32,
+        Float64
+    };
+
+    struct PlyProperty {
+        std::string name;
+        PlyScalarType type = PlyScalarType::Invalid;
+        PlyScalarType listCountType = PlyScalarType::Invalid;
+        bool isList = false;
+        size_t offset = 0;
+    };
+
+    struct PlyElement {
+        std::string name;
+        size_t count = 0;
+        size_t stride = 0;
+        bool hasListProperty = false;
+        std::vector<PlyProperty> properties;
+
+        int findProperty(std::string_view propertyName) const;
+    };
+
+    struct PlyHeader {
+        PlyFormat format = PlyFormat::Ascii;
+        std::vector<PlyElement> elements;
+        size_t dataOffset = 0;
+
+        static bool parse(std::string_view text, PlyHeader& outHeader);
+
+        int findElement(std::string_view elementName) const;
+        bool elementOffset(size_t elementIndex, size_t& outOffset) const;
+    };
+
+    size_t plyScalarSize(PlyScalarType type);
+    PlyScalarType plyScalarTypeFromName(std::string_view name);
+}
@@ -0,0 +1,457 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PointNodeStore.h"
+
+#include "Core/Logger.h"
+
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+#include <cfloat>
+#include <numeric>
+#include <random>
+#include <format>
+#include <unordered_set>
+
+namespace sfmeditor {
+    namespace {
+        constexpr char storeMagic[4] = {'S', 'F', 'M', 'N'};
+        constexpr uint32_t storeVersion = 2;
+
+        struct StoreHeader {
+            char magic[4];
+            uint32_t version;
+            uint64_t nodeCount;
+            uint64_t pointCount;
+            uint64_t sourceSize;
+            int64_t sourceModifiedTime;
+            uint64_t nodeTableOffset;
+        };
+
+        struct BuildTask {
+            uint32_t node;
+            size_t first;
+            size_t count;
+        };
+
+        bool sourceStamp(const std::string& sourcePath, uint64_t& outSize, int64_t& outModifiedTime) {
+            std::error_code sizeError, timeError;
+            outSize = std::filesystem::file_size(sourcePath, sizeError);
+            const auto modified = std::filesystem::last_write_time(sourcePath, timeError);
+            outModifiedTime = static_cast<int64_t>(modified.time_since_epoch().count());
+            return !sizeError && !timeError;
+        }
+
+        bool readHeader(std::istream& in, StoreHeader& outHeader) {
+            in.read(reinterpret_cast<char*>(&outHeader), sizeof(StoreHeader));
+            return in.good() && std::equal(std::begin(storeMagic), std::end(storeMagic), outHeader.magic) &&
+                outHeader.version == storeVersion;
+        }
+
+        uint32_t octantOf(const glm::vec3& position, const glm::vec3& center) {
+            return (position.x >= center.x ? 1u : 0u) | (position.y >= center.y ? 2u : 0u) |
+                (position.z >= center.z ? 4u : 0u);
+        }
+
+        // Cells up to this many points are built in memory; larger ones are split through spill files first.
+        constexpr uint64_t inCoreBuildPoints = 1 << 23;
+        constexpr size_t spillBlockPoints = 1 << 20;
+
+        struct SpillPoint {
+            glm::vec3 position;
+            glm::vec3 color;
+        };
+
+        struct SpillTask {
+            uint32_t node;
+            std::string path;
+            uint64_t count;
+        };
+
+        bool writeSpill(std::ostream& out, const std::vector<SpillPoint>& points) {
+            out.write(reinterpret_cast<const char*>(points.data()),
+                      static_cast<std::streamsize>(points.size() * sizeof(SpillPoint)));
+            return out.good();
+        }
+
+        template <typename Fn>
+        bool forEachSpillBlock(const SpillTask& task, Fn fn) {
+            std::ifstream in(task.path, std::ios::binary);
+            std::vector<SpillPoint> block;
+            for (uint64_t remaining = task.count; remaining > 0; remaining -= block.size()) {
+                block.resize(std::min<uint64_t>(remaining, spillBlockPoints));
+                in.read(reinterpret_cast<char*>(block.data()),
+                        static_cast<std::streamsize>(block.size() * sizeof(SpillPoint)));
+                if (!in) return false;
+                fn(block);
+            }
+            return true;
+        }
+
+        bool readSpill(const SpillTask& task, PointCloud& outPoints) {
+            outPoints.reserve(task.count);
+            return forEachSpillBlock(task, [&](const std::vector<SpillPoint>& block) {
+                for (const SpillPoint& point : block) outPoints.push_back(point.position, point.color);
+            });
+        }
+
+        void appendPayload(std::vector<StoredNode>& nodes, const uint32_t node, const PointCloud& points,
+                           std::ostream& out, uint64_t& offset) {
+            nodes[node].fileOffset = offset;
+            PointNodeStore::writePayload(out, nodes[node], points);
+            offset += PointNodeStore::payloadBytes(nodes[node].pointCount);
+        }
+
+        void appendChild(std::vector<StoredNode>& nodes, const uint32_t parent, const uint32_t octant) {
+            const StoredNode node = nodes[parent];
+            const glm::vec3 center = (node.min + node.max) * 0.5f;
+            const glm::vec3 childMin(octant & 1 ? center.x : node.min.x, octant & 2 ? center.y : node.min.y,
+                                     octant & 4 ? center.z : node.min.z);
+            const glm::vec3 childMax(octant & 1 ? node.max.x : center.x, octant & 2 ? node.max.y : center.y,
+                                     octant & 4 ? node.max.z : center.z);
+
+            if (nodes[parent].childCount == 0) nodes[parent].firstChild = static_cast<uint32_t>(nodes.size());
+            ++nodes[parent].childCount;
+            nodes.push_back({childMin, childMax, 0, 0, 0, node.depth + 1, 0});
+        }
+
+        // Builds the subtree under root from points held in memory and appends the payload of every node in it.
+        bool buildSubtree(std::vector<StoredNode>& nodes, const uint32_t root, const PointCloud& points,
+                          std::ostream& out, uint64_t& offset) {
+            if (points.size() > UINT32_MAX) {
+                Logger::error("Too many coincident points to build a streaming node store.");
+                return false;
+            }
+
+            std::vector<uint32_t> order(points.size());
+            std::iota(order.begin(), order.end(), 0u);
+            std::vector<uint32_t> scratch;
+            std::vector<uint8_t> octants;
+
+            std::vector<std::pair<uint32_t, size_t>> nodeFirst = {{root, 0}};
+            std::vector<BuildTask> tasks = {{root, 0, points.size()}};
+
+            while (!tasks.empty()) {
+                const BuildTask task = tasks.back();
+                tasks.pop_back();
+
+                const StoredNode node = nodes[task.node];
+                if (task.count <= PointNodeStore::maxNodePoints || node.depth >= PointNodeStore::maxDepth) {
+                    nodes[task.node].pointCount = static_cast<uint32_t>(task.count);
+                    continue;
+                }
+
+                // A partial shuffle moves a uniform sample of the cell to the front; the node keeps that sample.
+                uint32_t* range = order.data() + task.first;
+                std::minstd_rand random(task.node + 1);
+                for (size_t i = 0; i < PointNodeStore::maxNodePoints; ++i) {
+                    std::uniform_int_distribution<size_t> pick(i, task.count - 1);
+                    std::swap(range[i], range[pick(random)]);
+                }
+                nodes[task.node].pointCount = PointNodeStore::maxNodePoints;
+
+                const size_t restFirst = task.first + PointNodeStore::maxNodePoints;
+                const size_t restCount = task.count - PointNodeStore::maxNodePoints;
+                const glm::vec3 center = (node.min + node.max) * 0.5f;
+
+                size_t octantStarts[9] = {};
+                octants.resize(restCount);
+                for (size_t i = 0; i < restCount; ++i) {
+                    octants[i] = static_cast<uint8_t>(octantOf(points.positions[order[restFirst + i]], center));
+                    ++octantStarts[octants[i] + 1];
+                }
+                for (int octant = 0; octant < 8; ++octant) octantStarts[octant + 1] += octantStarts[octant];
+
+                scratch.resize(restCount);
+                size_t cursors[8];
+                std::copy(octantStarts, octantStarts + 8, cursors);
+                for (size_t i = 0; i < restCount; ++i) scratch[cursors[octants[i]]++] = order[restFirst + i];
+                std::copy(scratch.begin(), scratch.begin() + static_cast<std::ptrdiff_t>(restCount),
+                          order.begin() + static_cast<std::ptrdiff_t>(restFirst));
+
+                for (uint32_t octant = 0; octant < 8; ++octant) {
+                    const size_t count = octantStarts[octant + 1] - octantStarts[octant];
+                    if (count == 0) continue;
+
+                    const auto child = static_cast<uint32_t>(nodes.size());
+                    appendChild(nodes, task.node, octant);
+                    nodeFirst.emplace_back(child, restFirst + octantStarts[octant]);
+                    tasks.push_back({child, restFirst + octantStarts[octant], count});
+                }
+            }
+
+            PointCloud nodePoints;
+            for (const auto& [node, first] : nodeFirst) {
+                nodePoints.resize(nodes[node].pointCount);
+                for (uint32_t i = 0; i < nodes[node].pointCount; ++i) {
+                    const uint32_t source = order[first + i];
+                    nodePoints.positions[i] = points.positions[source];
+                    nodePoints.colors[i] = points.colors[source];
+                }
+                appendPayload(nodes, node, nodePoints, out, offset);
+            }
+            return out.good();
+        }
+
+        // Streams a cell that is too large for memory once: a uniform sample stays in the node and the rest is
+        // spilled into one file per child octant, which become tasks of their own.
+        bool splitSpill(std::vector<StoredNode>& nodes, const SpillTask& task, const std::string& storePath,
+                        std::ostream& out, uint64_t& offset, std::vector<SpillTask>& tasks) {
+            // Floyd's algorithm draws the sample positions without materializing the whole index range.
+            std::minstd_rand random(task.node + 1);
+            std::unordered_set<uint64_t> chosen;
+            for (uint64_t j = task.count - PointNodeStore::maxNodePoints; j < task.count; ++j) {
+                std::uniform_int_distribution<uint64_t> pick(0, j);
+                if (!chosen.insert(pick(random)).second) chosen.insert(j);
+            }
+            std::vector<uint64_t> sample(chosen.begin(), chosen.end());
+            std::sort(sample.begin(), sample.end());
+
+            const StoredNode node = nodes[task.node];
+            const glm::vec3 center = (node.min + node.max) * 0.5f;
+
+            PointCloud nodePoints;
+            nodePoints.reserve(PointNodeStore::maxNodePoints);
+            std::vector<SpillPoint> childBlocks[8];
+            std::ofstream childFiles[8];
+            uint64_t childCounts[8] = {};
+            auto childPath = [&](const uint32_t octant) {
+                return std::format("{}.spill{}-{}", storePath, task.node, octant);
+            };
+
+            uint64_t index = 0;
+            size_t nextSample = 0;
+            bool ok = forEachSpillBlock(task, [&](const std::vector<SpillPoint>& block) {
+                for (const SpillPoint& point : block) {
+                    if (nextSample < sample.size() && sample[nextSample] == index++) {
+                        nodePoints.push_back(point.position, point.color);
+                        ++nextSample;
+                    } else {
+                        childBlocks[octantOf(point.position, center)].push_back(point);
+                    }
+                }
+
+                for (uint32_t octant = 0; octant < 8; ++octant) {
+                    if (childBlocks[octant].empty()) continue;
+                    if (!childFiles[octant].is_open()) {
+                        childFiles[octant].open(childPath(octant), std::ios::binary | std::ios::trunc);
+                    }
+                    writeSpill(childFiles[octant], childBlocks[octant]);
+                    childCounts[octant] += childBlocks[octant].size();
+                    childBlocks[octant].clear();
+                }
+            });
+
+            for (uint32_t octant = 0; octant < 8; ++octant) {
+                if (!childFiles[octant].is_open()) continue;
+                childFiles[octant].close();
+                ok = ok && !childFiles[octant].fail();
+            }
+
+            nodes[task.node].pointCount = static_cast<uint32_t>(nodePoints.size());
+            appendPayload(nodes, task.node, nodePoints, out, offset);
+
+            for (uint32_t octant = 0; octant < 8; ++octant) {
+                if (childCounts[octant] == 0) continue;
+                const auto child = static_cast<uint32_t>(nodes.size());
+                appendChild(nodes, task.node, octant);
+                tasks.push_back({child, childPath(octant), childCounts[octant]});
+            }
+            return ok && out.good();
+        }
+    }
+
+    std::string PointNodeStore::storePath(const std::string& sourcePath) {
+        return sourcePath + ".sfmn";
+    }
+
+    bool PointNodeStore::isCurrent(const std::string& sourcePath) {
+        std::ifstream in(storePath(sourcePath), std::ios::binary);
+        StoreHeader header{};
+        if (!in || !readHeader(in, header)) return false;
+
+        uint64_t size = 0;
+        int64_t modifiedTime = 0;
+        return sourceStamp(sourcePath, size, modifiedTime) && header.sourceSize == size &&
+            header.sourceModifiedTime == modifiedTime;
+    }
+
+    bool PointNodeStore::convert(const std::string& sourcePath, const PointChunkSource& readPoints) {
+        const auto startTime = std::chrono::steady_clock::now();
+
+        const std::string path = storePath(sourcePath);
+        const std::string tempPath = path + ".tmp";
+        const std::string rootSpillPath = path + ".spill";
+        std::error_code ec;
+
+        // Pass over the source once, staging every chunk so that the build below never rereads or parses it.
+        uint64_t pointCount = 0;
+        glm::vec3 minBound(FLT_MAX), maxBound(-FLT_MAX);
+        {
+            std::ofstream stage(rootSpillPath, std::ios::binary | std::ios::trunc);
+            std::vector<SpillPoint> block;
+            const bool read = stage && readPoints([&](const PointCloud& chunk) {
+                block.resize(chunk.size());
+                for (size_t i = 0; i < chunk.size(); ++i) {
+                    block[i] = {chunk.positions[i], chunk.colors[i]};
+                    minBound = glm::min(minBound, chunk.positions[i]);
+                    maxBound = glm::max(maxBound, chunk.positions[i]);
+                }
+                pointCount += chunk.size();
+                return writeSpill(stage, block);
+            });
+
+            if (!read || pointCount == 0) {
+                if (!stage) Logger::warn("Could not write point node store: " + path);
+                stage.close();
+                std::filesystem::remove(rootSpillPath, ec);
+                return false;
+            }
+        }
+
+        // Cubic cells keep every child the same shape as its parent.
+        const glm::vec3 extent = maxBound - minBound;
+        const float size = std::max({extent.x, extent.y, extent.z, 1e-6f});
+
+        std::vector<StoredNode> nodes = {{minBound, minBound + glm::vec3(size), 0, 0, 0, 0, 0}};
+        std::vector<SpillTask> tasks = {{0, rootSpillPath, pointCount}};
+
+        StoreHeader header{};
+        std::copy(std::begin(storeMagic), std::end(storeMagic), header.magic);
+        header.version = storeVersion;
+        header.pointCount = pointCount;
+        bool ok = sourceStamp(sourcePath, header.sourceSize, header.sourceModifiedTime);
+
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(StoreHeader));
+            uint64_t offset = sizeof(StoreHeader);
+
+            while (ok && out && !tasks.empty()) {
+                const SpillTask task = std::move(tasks.back());
+                tasks.pop_back();
+
+                if (task.count > inCoreBuildPoints && nodes[task.node].depth < maxDepth) {
+                    ok = splitSpill(nodes, task, path, out, offset, tasks);
+                } else {
+                    PointCloud points;
+                    ok = readSpill(task, points) && buildSubtree(nodes, task.node, points, out, offset);
+                }
+                std::filesystem::remove(task.path, ec);
+            }
+            for (const SpillTask& task : tasks) std::filesystem::remove(task.path, ec);
+
+            // Payload sizes are only known once the tree is built, so the node table follows them.
+            header.nodeCount = nodes.size();
+            header.nodeTableOffset = offset;
+            out.write(reinterpret_cast<const char*>(nodes.data()),
+                      static_cast<std::streamsize>(nodes.size() * sizeof(StoredNode)));
+            out.seekp(0);
+            out.write(reinterpret_cast<const char*>(&header), sizeof(StoreHeader));
+            ok = ok && out.good();
+        }
+
+        if (!ok) {
+            std::filesystem::remove(tempPath, ec);
+            Logger::warn("Could not write point node store: " + path);
+            return false;
+        }
+
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            Logger::warn("Could not write point node store: " + path);
+            return false;
+        }
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        Logger::info(std::format("Wrote point node store with {} nodes in {:.0f} ms: {}", nodes.size(),
+                                 seconds * 1000.0, path));
+        return true;
+    }
+
+    bool PointNodeStore::readNodes(const std::string& storePath, std::vector<StoredNode>& outNodes,
+                                   uint64_t& outPointCount) {
+        std::ifstream in(storePath, std::ios::binary);
+        StoreHeader header{};
+        if (!in || !readHeader(in, header)) {
+            Logger::error("Invalid point node store: " + storePath);
+            return false;
+        }
+
+        std::error_code ec;
+        const uint64_t fileSize = std::filesystem::file_size(storePath, ec);
+        if (ec || header.nodeCount == 0 || header.nodeTableOffset < sizeof(StoreHeader) ||
+            header.nodeTableOffset > fileSize ||
+            header.nodeCount > (fileSize - header.nodeTableOffset) / sizeof(StoredNode)) {
+            Logger::error("Truncated point node store: " + storePath);
+            return false;
+        }
+
+        outNodes.resize(header.nodeCount);
+        in.seekg(static_cast<std::streamoff>(header.nodeTableOffset));
+        in.read(reinterpret_cast<char*>(outNodes.data()),
+                static_cast<std::streamsize>(outNodes.size() * sizeof(StoredNode)));
+        if (!in) {
+            Logger::error("Truncated point node store: " + storePath);
+            return false;
+        }
+
+        for (const StoredNode& node : outNodes) {
+            if (node.firstChild + static_cast<uint64_t>(node.childCount) > outNodes.size() ||
+                node.fileOffset + payloadBytes(node.pointCount) > fileSize) {
+                Logger::error("Corrupt point node store: " + storePath);
+                return false;
+            }
+        }
+
+        outPointCount = header.pointCount;
+        return true;
+    }
+
+    uint64_t PointNodeStore::payloadBytes(const uint64_t pointCount) {
+        return pointCount * (2 * sizeof(glm::vec3) + sizeof(uint8_t));
+    }
+
+    bool PointNodeStore::readPayload(std::istream& in, const StoredNode& node, PointCloud& outPoints) {
+        const size_t count = node.pointCount;
+        outPoints.resize(count);
+
+        in.seekg(static_cast<std::streamoff>(node.fileOffset));
+        in.read(reinterpret_cast<char*>(outPoints.positions.data()),
+                static_cast<std::streamsize>(count * sizeof(glm::vec3)));
+        in.read(reinterpret_cast<char*>(outPoints.colors.data()),
+                static_cast<std::streamsize>(count * sizeof(glm::vec3)));
+        in.read(reinterpret_cast<char*>(outPoints.flags.data()), static_cast<std::streamsize>(count));
+        return in.good();
+    }
+
+    bool PointNodeStore::writePayload(std::ostream& out, const StoredNode& node, const PointCloud& points) {
+        const size_t count = node.pointCount;
+        if (points.size() != count) return false;
+
+        out.seekp(static_cast<std::streamoff>(node.fileOffset));
+        out.write(reinterpret_cast<const char*>(points.positions.data()),
+                  static_cast<std::streamsize>(count * sizeof(glm::vec3)));
+        out.write(reinterpret_cast<const char*>(points.colors.data()),
+                  static_cast<std::streamsize>(count * sizeof(glm::vec3)));
+        out.write(reinterpret_cast<const char*>(points.flags.data()), static_cast<std::streamsize>(count));
+        return out.good();
+    }
+}
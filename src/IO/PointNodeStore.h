@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Core/PointCloud.hpp"
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace sfmeditor {
+    // One node of the on-disk hierarchy. Inner nodes hold a random sample of their subtree and leaves hold what
+    // is left, so every point is stored exactly once and a node alone is a coarse version of its whole cell.
+    struct StoredNode {
+        glm::vec3 min;
+        glm::vec3 max;
+        uint32_t firstChild;
+        uint32_t childCount;
+        uint32_t pointCount;
+        uint32_t depth;
+        uint64_t fileOffset;
+    };
+
+    // A point source hands its points over one bounded chunk at a time; the sink returns false to stop reading.
+    using PointChunkSink = std::function<bool(const PointCloud& chunk)>;
+    using PointChunkSource = std::function<bool(const PointChunkSink& sink)>;
+
+    // Built straight from the source file without holding the whole cloud: chunks are staged to a spill file,
+    // cells too large for memory are split through further spill files, and smaller cells are built in memory.
+    class PointNodeStore {
+    public:
+        static constexpr uint32_t maxNodePoints = 16384;
+        static constexpr uint32_t maxDepth = 20;
+
+        static std::string storePath(const std::string& sourcePath);
+
+        static bool isCurrent(const std::string& sourcePath);
+        static bool convert(const std::string& sourcePath, const PointChunkSource& readPoints);
+        static bool readNodes(const std::string& storePath, std::vector<StoredNode>& outNodes,
+                              uint64_t& outPointCount);
+
+        static uint64_t payloadBytes(uint64_t pointCount);
+        static bool readPayload(std::istream& in, const StoredNode& node, PointCloud& outPoints);
+        static bool writePayload(std::ostream& out, const StoredNode& node, const PointCloud& points);
+    };
+}
@@ -0,0 +1,334 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PointStreamer.h"
+
+#include "Core/Logger.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <fstream>
+#include <format>
+
+namespace sfmeditor {
+    PointStreamer::~PointStreamer() {
+        close();
+    }
+
+    bool PointStreamer::open(const std::string& storePath, const size_t hostBudgetBytes) {
+        close();
+        if (!PointNodeStore::readNodes(storePath, m_nodes, m_pointCount)) return false;
+
+        m_path = storePath;
+        m_hostBudget = hostBudgetBytes;
+        m_states.assign(m_nodes.size(), NodeState::Absent);
+        m_revisions.assign(m_nodes.size(), 0);
+        m_stopping = false;
+
+        for (size_t i = 0; i < ioThreadCount; ++i) m_workers.emplace_back([this]() { ioLoop(); });
+
+        Logger::info(std::format("Streaming {} points from {} nodes: {}", m_pointCount, m_nodes.size(), storePath));
+        return true;
+    }
+
+    void PointStreamer::close() {
+        if (!m_workers.empty()) {
+            {
+                std::lock_guard lock(m_queueMutex);
+                m_stopping = true;
+            }
+            m_queueSignal.notify_all();
+            for (std::thread& worker : m_workers) worker.join();
+            m_workers.clear();
+        }
+        writeBackAll();
+
+        m_path.clear();
+        m_nodes.clear();
+        m_pointCount = 0;
+        m_states.clear();
+        m_revisions.clear();
+        m_resident.clear();
+        m_pendingEdits.clear();
+        m_order.clear();
+        m_residentBytes = 0;
+        m_selectedCount = 0;
+        m_queue.clear();
+        m_inFlight = 0;
+        m_results.clear();
+    }
+
+    size_t PointStreamer::pendingCount() const {
+        std::lock_guard lock(m_queueMutex);
+        return m_queue.size() + m_inFlight;
+    }
+
+    void PointStreamer::update() {
+        if (m_nodes.empty()) return;
+        ++m_frame;
+
+        // Loads that have not started are dropped; the current view requests again whatever it still needs.
+        {
+            std::lock_guard lock(m_queueMutex);
+            std::erase_if(m_queue, [this](const IoJob& job) {
+                if (job.writeData) return false;
+                m_states[job.node] = NodeState::Absent;
+                return true;
+            });
+            std::make_heap(m_queue.begin(), m_queue.end());
+        }
+
+        std::vector<IoResult> results;
+        {
+            std::lock_guard lock(m_resultMutex);
+            results.swap(m_results);
+        }
+
+        for (IoResult& result : results) {
+            if (!result.ok) {
+                Logger::error(std::format("Could not {} streamed node {}: {}", result.write ? "write back" : "load",
+                                          result.node, m_path));
+            }
+            if (result.write) {
+                m_states[result.node] = NodeState::Absent;
+                continue;
+            }
+            if (!result.ok) {
+                m_states[result.node] = NodeState::Failed;
+                continue;
+            }
+
+            m_order.push_front(result.node);
+            ResidentNode& resident = m_resident[result.node];
+            resident = {std::move(result.points), m_order.begin(), m_frame};
+            if (const auto edits = m_pendingEdits.find(result.node); edits != m_pendingEdits.end()) {
+                applyEdits(*resident.points, edits->second);
+                resident.dirty = true;
+                m_pendingEdits.erase(edits);
+                ++m_revisions[result.node];
+            }
+            m_residentBytes += PointNodeStore::payloadBytes(m_nodes[result.node].pointCount);
+            m_states[result.node] = NodeState::Resident;
+        }
+
+        evictOverBudget();
+    }
+
+    void PointStreamer::request(const uint32_t node, const float priority) {
+        if (m_states[node] != NodeState::Absent) return;
+        m_states[node] = NodeState::Pending;
+
+        {
+            std::lock_guard lock(m_queueMutex);
+            m_queue.push_back({priority, node, nullptr});
+            std::push_heap(m_queue.begin(), m_queue.end());
+        }
+        m_queueSignal.notify_one();
+    }
+
+    const PointCloud* PointStreamer::acquire(const uint32_t node) {
+        const auto it = m_resident.find(node);
+        if (it == m_resident.end()) return nullptr;
+
+        m_order.splice(m_order.begin(), m_order, it->second.order);
+        it->second.lastUsedFrame = m_frame;
+        return it->second.points.get();
+    }
+
+    bool PointStreamer::setSelected(const uint32_t node, const uint32_t point, const bool selected) {
+        const auto it = m_resident.find(node);
+        if (it == m_resident.end()) return false;
+
+        ResidentNode& resident = it->second;
+        PointCloud& points = *resident.points;
+        if (point >= points.size() || points.isSelected(point) == selected) return false;
+
+        points.setFlag(point, PointSelected, selected);
+        if (selected) {
+            ++resident.selectedCount;
+            ++m_selectedCount;
+        } else {
+            --resident.selectedCount;
+            --m_selectedCount;
+        }
+        ++m_revisions[node];
+        return true;
+    }
+
+    void PointStreamer::clearSelection() {
+        for (auto& [node, resident] : m_resident) {
+            if (resident.selectedCount == 0) continue;
+            for (uint8_t& flags : resident.points->flags) flags &= ~PointSelected;
+            resident.selectedCount = 0;
+            ++m_revisions[node];
+        }
+        m_selectedCount = 0;
+    }
+
+    std::vector<StreamedPoint> PointStreamer::deleteSelected() {
+        std::vector<StreamedPoint> deleted;
+        deleted.reserve(m_selectedCount);
+        for (auto& [node, resident] : m_resident) {
+            if (resident.selectedCount == 0) continue;
+
+            std::vector<uint8_t>& flags = resident.points->flags;
+            for (uint32_t i = 0; i < flags.size(); ++i) {
+                if (!(flags[i] & PointSelected)) continue;
+                flags[i] = static_cast<uint8_t>((flags[i] | PointDeleted) & ~PointSelected);
+                deleted.push_back({node, i});
+            }
+            resident.selectedCount = 0;
+            resident.dirty = true;
+            ++m_revisions[node];
+        }
+        m_selectedCount = 0;
+        return deleted;
+    }
+
+    void PointStreamer::setDeleted(const std::span<const StreamedPoint> points, const bool deleted) {
+        for (const StreamedPoint& point : points) {
+            const auto it = m_resident.find(point.node);
+            if (it == m_resident.end()) {
+                m_pendingEdits[point.node].push_back({point.point, deleted});
+                continue;
+            }
+
+            ResidentNode& resident = it->second;
+            if (point.point >= resident.points->size()) continue;
+            if (resident.points->isSelected(point.point)) {
+                --resident.selectedCount;
+                --m_selectedCount;
+            }
+            const PendingEdit edit{point.point, deleted};
+            applyEdits(*resident.points, {&edit, 1});
+            resident.dirty = true;
+            ++m_revisions[point.node];
+        }
+    }
+
+    void PointStreamer::applyEdits(PointCloud& points, const std::span<const PendingEdit> edits) {
+        for (const PendingEdit& edit : edits) {
+            if (edit.point >= points.size()) continue;
+            uint8_t& flags = points.flags[edit.point];
+            flags = static_cast<uint8_t>(edit.deleted ? (flags | PointDeleted) & ~PointSelected
+                                                      : flags & ~PointDeleted);
+        }
+    }
+
+    void PointStreamer::ioLoop() {
+        std::fstream file(m_path, std::ios::in | std::ios::out | std::ios::binary);
+
+        while (true) {
+            IoJob job;
+            {
+                std::unique_lock lock(m_queueMutex);
+                m_queueSignal.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+                if (m_stopping) return;
+
+                std::pop_heap(m_queue.begin(), m_queue.end());
+                job = std::move(m_queue.back());
+                m_queue.pop_back();
+                ++m_inFlight;
+            }
+
+            IoResult result{job.node, nullptr, job.writeData != nullptr, false};
+            if (result.write) {
+                result.ok = PointNodeStore::writePayload(file, m_nodes[job.node], *job.writeData) && file.flush();
+            } else {
+                result.points = std::make_shared<PointCloud>();
+                result.ok = PointNodeStore::readPayload(file, m_nodes[job.node], *result.points);
+            }
+            file.clear();
+
+            {
+                std::lock_guard lock(m_resultMutex);
+                m_results.push_back(std::move(result));
+            }
+            {
+                std::lock_guard lock(m_queueMutex);
+                --m_inFlight;
+            }
+        }
+    }
+
+    void PointStreamer::evictOverBudget() {
+        auto it = m_order.end();
+        while (m_residentBytes > m_hostBudget && it != m_order.begin()) {
+            --it;
+            const uint32_t node = *it;
+            ResidentNode& resident = m_resident.at(node);
+
+            // Nodes used last frame are still in view; nodes holding selected points stay until deselected.
+            if (resident.lastUsedFrame + 1 >= m_frame) break;
+            if (resident.selectedCount > 0) continue;
+
+            if (resident.dirty) {
+                {
+                    std::lock_guard lock(m_queueMutex);
+                    m_queue.push_back({FLT_MAX, node, std::move(resident.points)});
+                    std::push_heap(m_queue.begin(), m_queue.end());
+                }
+                m_queueSignal.notify_one();
+                m_states[node] = NodeState::Writing;
+            } else {
+                m_states[node] = NodeState::Absent;
+            }
+
+            m_residentBytes -= PointNodeStore::payloadBytes(m_nodes[node].pointCount);
+            m_resident.erase(node);
+            it = m_order.erase(it);
+        }
+    }
+
+    void PointStreamer::writeBackAll() {
+        std::vector<std::pair<uint32_t, std::shared_ptr<PointCloud>>> writes;
+        for (IoJob& job : m_queue) {
+            if (job.writeData) writes.emplace_back(job.node, std::move(job.writeData));
+        }
+        for (auto& [node, resident] : m_resident) {
+            if (resident.dirty) writes.emplace_back(node, resident.points);
+        }
+        if (writes.empty() && m_pendingEdits.empty()) return;
+
+        std::fstream file(m_path, std::ios::in | std::ios::out | std::ios::binary);
+        size_t failed = 0;
+        for (auto& [node, points] : writes) {
+            for (uint8_t& flags : points->flags) flags &= ~PointSelected;
+            if (!PointNodeStore::writePayload(file, m_nodes[node], *points)) ++failed;
+            file.clear();
+        }
+
+        // Undo/redo edits to nodes that were never loaded again; the pending writes above already hit the file.
+        for (const auto& [node, edits] : m_pendingEdits) {
+            PointCloud points;
+            if (!PointNodeStore::readPayload(file, m_nodes[node], points)) {
+                ++failed;
+                file.clear();
+                continue;
+            }
+            applyEdits(points, edits);
+            if (!PointNodeStore::writePayload(file, m_nodes[node], points)) ++failed;
+            file.clear();
+        }
+
+        if (failed > 0) {
+            Logger::error(std::format("Could not write back {} streamed nodes: {}", failed, m_path));
+        } else {
+            Logger::info(std::format("Wrote back {} edited nodes: {}", writes.size() + m_pendingEdits.size(), m_path));
+        }
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "PointNodeStore.h"
+
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sfmeditor {
+    struct StreamedPoint {
+        uint32_t node;
+        uint32_t point;
+    };
+
+    // Keeps a bounded working set of store nodes in memory. Loads and write-backs run on background I/O threads;
+    // the main thread requests what the view needs each frame and evicts the least recently used nodes.
+    class PointStreamer {
+    public:
+        PointStreamer() = default;
+        ~PointStreamer();
+        PointStreamer(const PointStreamer&) = delete;
+        PointStreamer& operator=(const PointStreamer&) = delete;
+
+        bool open(const std::string& storePath, size_t hostBudgetBytes);
+        void close();
+
+        const std::vector<StoredNode>& nodes() const { return m_nodes; }
+        uint64_t pointCount() const { return m_pointCount; }
+        size_t residentBytes() const { return m_residentBytes; }
+        size_t residentCount() const { return m_resident.size(); }
+        size_t pendingCount() const;
+
+        size_t hostBudget() const { return m_hostBudget; }
+        void setHostBudget(const size_t bytes) { m_hostBudget = bytes; }
+
+        void update();
+        void request(uint32_t node, float priority);
+        const PointCloud* acquire(uint32_t node);
+        uint32_t revision(const uint32_t node) const { return m_revisions[node]; }
+
+        template <typename Fn>
+        void forEachResident(Fn&& fn) const {
+            for (const auto& [node, resident] : m_resident) fn(node, static_cast<const PointCloud&>(*resident.points));
+        }
+
+        bool setSelected(uint32_t node, uint32_t point, bool selected);
+        void clearSelection();
+        std::vector<StreamedPoint> deleteSelected();
+        size_t selectedCount() const { return m_selectedCount; }
+
+        // Used by undo and redo. Edits to nodes that are not resident are queued and applied when the node is
+        // next loaded, or written back on close.
+        void setDeleted(std::span<const StreamedPoint> points, bool deleted);
+
+    private:
+        enum class NodeState : uint8_t { Absent, Pending, Resident, Writing, Failed };
+
+        // Write-backs carry their data so the node can leave the resident set before the write finishes.
+        struct IoJob {
+            float priority;
+            uint32_t node;
+            std::shared_ptr<PointCloud> writeData;
+
+            bool operator<(const IoJob& other) const { return priority < other.priority; }
+        };
+
+        struct IoResult {
+            uint32_t node;
+            std::shared_ptr<PointCloud> points;
+            bool write;
+            bool ok;
+        };
+
+        struct ResidentNode {
+            std::shared_ptr<PointCloud> points;
+            std::list<uint32_t>::iterator order;
+            uint64_t lastUsedFrame = 0;
+            uint32_t selectedCount = 0;
+            bool dirty = false;
+        };
+
+        static constexpr size_t ioThreadCount = 2;
+
+        struct PendingEdit {
+            uint32_t point;
+            bool deleted;
+        };
+
+        void ioLoop();
+        void evictOverBudget();
+        void writeBackAll();
+        static void applyEdits(PointCloud& points, std::span<const PendingEdit> edits);
+
+        std::string m_path;
+        std::vector<StoredNode> m_nodes;
+        uint64_t m_pointCount = 0;
+
+        std::vector<NodeState> m_states;
+        std::vector<uint32_t> m_revisions;
+        std::unordered_map<uint32_t, ResidentNode> m_resident;
+        std::unordered_map<uint32_t, std::vector<PendingEdit>> m_pendingEdits;
+        std::list<uint32_t> m_order;
+        size_t m_residentBytes = 0;
+        size_t m_hostBudget = 0;
+        size_t m_selectedCount = 0;
+        uint64_t m_frame = 0;
+
+        mutable std::mutex m_queueMutex;
+        std::condition_variable m_queueSignal;
+        std::vector<IoJob> m_queue;
+        size_t m_inFlight = 0;
+        bool m_stopping = false;
+
+        std::mutex m_resultMutex;
+        std::vector<IoResult> m_results;
+
+        std::vector<std::thread> m_workers;
+    };
+}
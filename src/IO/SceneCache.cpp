@@ -0,0 +1,442 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SceneCache.h"
+
+#include "MappedFile.h"
+#include "ModelLoader.h"
+#include "Core/Logger.h"
+
+#include <filesystem>
+#include <fstream>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <format>
+
+namespace sfmeditor {
+    namespace {
+        constexpr char cacheMagic[4] = {'S', 'F', 'M', 'C'};
+        constexpr uint32_t cacheVersion = 5;
+        constexpr uint32_t lazyFeaturesFlag = 1;
+        constexpr size_t sectionAlignment = 64;
+
+        enum class CacheSection : uint32_t {
+            Sources,
+            PointPositions,
+            PointColors,
+            PointMetadata,
+            TrackOffsets,
+            TrackObservations,
+            Cameras,
+            CameraParams,
+            Images,
+            ImageNames,
+            FeatureCoordinates,
+            FeaturePointIndices,
+            Count
+        };
+
+        struct CacheHeader {
+            char magic[4];
+            uint32_t version;
+            uint32_t sectionCount;
+            uint32_t flags;
+        };
+
+        struct CacheSectionEntry {
+            uint64_t offset;
+            uint64_t size;
+        };
+
+        struct SourceStamp {
+            uint64_t size;
+            int64_t modifiedTime;
+        };
+
+        struct CachedCamera {
+            uint32_t cameraID;
+            int32_t modelId;
+            uint64_t width;
+            uint64_t height;
+            float focalLength;
+            float focalLengthY;
+            float principalPointX;
+            float principalPointY;
+            uint64_t paramOffset;
+            uint64_t paramCount;
+        };
+
+        struct CachedImage {
+            uint32_t imageID;
+            uint32_t cameraID;
+            float position[3];
+            float orientation[4];
+            uint32_t nameLength;
+            uint64_t nameOffset;
+            uint64_t featureOffset;
+            uint64_t featureCount;
+        };
+
+        constexpr size_t sectionCount = static_cast<size_t>(CacheSection::Count);
+
+        bool expectsLazyFeatures(const std::filesystem::path& sourcePath, const LoadOptions& options) {
+            return options.lazyFeatures && sourcePath.extension() == ".bin";
+        }
+
+        std::vector<SourceStamp> sourceStamps(const std::filesystem::path& sourcePath) {
+            std::vector<std::filesystem::path> sources;
+            const std::string ext = sourcePath.extension().string();
+            if (ext == ".bin" || ext == ".txt") {
+                for (const char* name : {"points3D", "cameras", "images"}) {
+                    sources.push_back(sourcePath.parent_path() / (name + ext));
+                }
+            } else {
+                sources.push_back(sourcePath);
+            }
+
+            std::vector<SourceStamp> stamps;
+            for (const auto& source : sources) {
+                std::error_code sizeError, timeError;
+                const uint64_t size = std::filesystem::file_size(source, sizeError);
+                const auto modified = std::filesystem::last_write_time(source, timeError);
+
+                if (sizeError || timeError) stamps.push_back({UINT64_MAX, 0});
+                else stamps.push_back({size, static_cast<int64_t>(modified.time_since_epoch().count())});
+            }
+            return stamps;
+        }
+
+        class SectionWriter {
+        public:
+            explicit SectionWriter(std::ofstream& out) : m_out(out) {
+                const std::vector<char> placeholder(sizeof(CacheHeader) + sizeof(m_entries), 0);
+                m_out.write(placeholder.data(), static_cast<std::streamsize>(placeholder.size()));
+                m_position = placeholder.size();
+            }
+
+            void begin(const CacheSection section) {
+                static constexpr char padding[sectionAlignment] = {};
+                const size_t aligned = (m_position + sectionAlignment - 1) / sectionAlignment * sectionAlignment;
+                m_out.write(padding, static_cast<std::streamsize>(aligned - m_position));
+                m_position = aligned;
+                m_current = static_cast<size_t>(section);
+                m_entries[m_current] = {m_position, 0};
+            }
+
+            template <typename T>
+            void append(const T* data, const size_t count) {
+                const size_t bytes = count * sizeof(T);
+                m_out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+                m_position += bytes;
+                m_entries[m_current].size += bytes;
+            }
+
+            template <typename T>
+            void add(const CacheSection section, const std::vector<T>& values) {
+                begin(section);
+                append(values.data(), values.size());
+            }
+
+            bool finish(const uint32_t flags) {
+                const CacheHeader header{
+                    {cacheMagic[0], cacheMagic[1], cacheMagic[2], cacheMagic[3]}, cacheVersion,
+                    static_cast<uint32_t>(sectionCount), flags
+                };
+                m_out.seekp(0);
+                m_out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+                m_out.write(reinterpret_cast<const char*>(m_entries), sizeof(m_entries));
+                m_out.flush();
+                return static_cast<bool>(m_out);
+            }
+
+        private:
+            std::ofstream& m_out;
+            CacheSectionEntry m_entries[sectionCount] = {};
+            size_t m_current = 0;
+            size_t m_position = 0;
+        };
+
+        class SectionTable {
+        public:
+            bool open(const MappedFile& file, uint32_t& outFlags) {
+                m_file = &file;
+                if (file.size() < sizeof(CacheHeader) + sizeof(m_entries)) return false;
+
+                CacheHeader header;
+                std::memcpy(&header, file.data(), sizeof(header));
+                if (std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 || header.version != cacheVersion ||
+                    header.sectionCount != sectionCount) {
+                    return false;
+                }
+
+                outFlags = header.flags;
+                std::memcpy(m_entries, file.data() + sizeof(header), sizeof(m_entries));
+                for (const auto& entry : m_entries) {
+                    if (entry.offset % sectionAlignment != 0 || entry.offset > file.size() ||
+                        entry.size > file.size() - entry.offset) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            template <typename T>
+            bool get(const CacheSection section, std::span<const T>& outValues) const {
+                const CacheSectionEntry& entry = m_entries[static_cast<size_t>(section)];
+                if (entry.size % sizeof(T) != 0) return false;
+                outValues = {reinterpret_cast<const T*>(m_file->data() + entry.offset), entry.size / sizeof(T)};
+                return true;
+            }
+
+        private:
+            const MappedFile* m_file = nullptr;
+            CacheSectionEntry m_entries[sectionCount] = {};
+        };
+    }
+
+    std::string SceneCache::cachePath(const std::string& sourcePath) {
+        return sourcePath + ".sfmc";
+    }
+
+    bool SceneCache::load(const std::string& sourcePath, const LoadOptions& options, SfMScene& outScene,
+                          LoadProgress& progress) {
+        const std::string path = cachePath(sourcePath);
+        if (!std::filesystem::exists(path)) return false;
+
+        // Tracks and features keep viewing the mapping, so it lives as long as the scene holds them.
+        const auto mapping = std::make_shared<const MappedFile>(path);
+        const MappedFile& file = *mapping;
+        if (!file.isOpen()) return false;
+
+        const auto startTime = std::chrono::steady_clock::now();
+        progress.begin(file.size());
+
+        SectionTable table;
+        uint32_t flags = 0;
+        std::span<const SourceStamp> cachedStamps;
+        if (!table.open(file, flags) || !table.get(CacheSection::Sources, cachedStamps)) {
+            Logger::warn("Ignoring outdated or corrupt scene cache: " + path);
+            return false;
+        }
+
+        const bool lazyFeatures = (flags & lazyFeaturesFlag) != 0;
+        const std::vector<SourceStamp> stamps = sourceStamps(sourcePath);
+        if (cachedStamps.size() != stamps.size() ||
+            std::memcmp(cachedStamps.data(), stamps.data(), stamps.size() * sizeof(SourceStamp)) != 0 ||
+            lazyFeatures != expectsLazyFeatures(sourcePath, options)) {
+            Logger::info("Scene cache is stale, reloading from source: " + sourcePath);
+            return false;
+        }
+
+        std::span<const glm::vec3> positions;
+        std::span<const glm::vec3> colors;
+        std::span<const PointMetadata> metadata;
+        std::span<const uint64_t> trackOffsets;
+        std::span<const double> cameraParams;
+        std::span<const PointObservation> observations;
+        std::span<const CachedCamera> cameras;
+        std::span<const CachedImage> images;
+        std::span<const char> imageNames;
+        std::span<const glm::vec2> featureCoordinates;
+        std::span<const uint32_t> featurePointIndices;
+
+        bool valid = table.get(CacheSection::PointPositions, positions) &&
+            table.get(CacheSection::PointColors, colors) && table.get(CacheSection::PointMetadata, metadata) &&
+            table.get(CacheSection::TrackOffsets, trackOffsets) &&
+            table.get(CacheSection::TrackObservations, observations) && table.get(CacheSection::Cameras, cameras) &&
+            table.get(CacheSection::CameraParams, cameraParams) && table.get(CacheSection::Images, images) &&
+            table.get(CacheSection::ImageNames, imageNames) &&
+            table.get(CacheSection::FeatureCoordinates, featureCoordinates) &&
+            table.get(CacheSection::FeaturePointIndices, featurePointIndices);
+        valid = valid && featurePointIndices.size() == featureCoordinates.size() && colors.size() == positions.size();
+
+        const bool hasMetadata = !metadata.empty();
+        if (hasMetadata) {
+            valid = valid && metadata.size() == positions.size() && trackOffsets.size() == positions.size() + 1 &&
+                trackOffsets.front() == 0 && trackOffsets.back() == observations.size();
+            for (size_t i = 0; valid && i < positions.size(); ++i) {
+                valid = trackOffsets[i] <= trackOffsets[i + 1];
+            }
+        }
+        for (size_t i = 0; valid && i < cameras.size(); ++i) {
+            valid = cameras[i].paramOffset <= cameraParams.size() &&
+                cameras[i].paramCount <= cameraParams.size() - cameras[i].paramOffset;
+        }
+        for (size_t i = 0; valid && i < images.size(); ++i) {
+            valid = images[i].nameOffset <= imageNames.size() &&
+                images[i].nameLength <= imageNames.size() - images[i].nameOffset &&
+                (lazyFeatures || (images[i].featureOffset <= featureCoordinates.size() &&
+                    images[i].featureCount <= featureCoordinates.size() - images[i].featureOffset));
+        }
+        if (!valid) {
+            Logger::warn("Ignoring corrupt scene cache: " + path);
+            return false;
+        }
+
+        SfMScene scene;
+        scene.points.positions.assign(positions.begin(), positions.end());
+        scene.points.colors.assign(colors.begin(), colors.end());
+        scene.points.flags.assign(positions.size(), 0);
+        const size_t pointBytes = positions.size_bytes() + colors.size_bytes();
+        progress.advance(pointBytes);
+
+        const size_t metadataBytes = metadata.size_bytes() + trackOffsets.size_bytes() + observations.size_bytes();
+
+        if (hasMetadata) {
+            scene.metadata.assign(metadata.begin(), metadata.end());
+            scene.tracks.assign({trackOffsets, mapping}, {observations, mapping});
+            progress.advance(metadataBytes);
+        }
+
+        scene.cameras.reserve(cameras.size());
+        for (const CachedCamera& cached : cameras) {
+            Camera cam{cached.cameraID, cached.modelId, cached.width, cached.height};
+            cam.focalLength = cached.focalLength;
+            cam.focalLengthY = cached.focalLengthY;
+            cam.principalPointX = cached.principalPointX;
+            cam.principalPointY = cached.principalPointY;
+            cam.extraParams.assign(cameraParams.begin() + cached.paramOffset,
+                                   cameraParams.begin() + cached.paramOffset + cached.paramCount);
+            scene.cameras.insert(cam.cameraID, std::move(cam));
+        }
+
+        if (lazyFeatures) {
+            ModelLoader::attachColmapFeatureSource(
+                scene.features, (std::filesystem::path(sourcePath).parent_path() / "images.bin").string());
+            ModelLoader::resolveFeaturePoints(scene);
+        } else {
+            scene.features.assign({featureCoordinates, mapping}, {featurePointIndices, mapping});
+        }
+
+        scene.images.reserve(images.size());
+        scene.imageNames.reserve(images.size());
+        for (size_t i = 0; i < images.size(); ++i) {
+            if (progress.isCancelled()) break;
+
+            const CachedImage& cached = images[i];
+            CameraPose img;
+            img.imageID = cached.imageID;
+            img.cameraID = cached.cameraID;
+            img.nameId = scene.imageNames.intern({imageNames.data() + cached.nameOffset, cached.nameLength});
+            img.position = {cached.position[0], cached.position[1], cached.position[2]};
+            img.orientation = glm::quat(cached.orientation[0], cached.orientation[1], cached.orientation[2],
+                                        cached.orientation[3]);
+            scene.features.setRange(img.imageID, cached.featureOffset, cached.featureCount);
+            scene.images.insert(img.imageID, img);
+        }
+        progress.advance(file.size() - pointBytes - (hasMetadata ? metadataBytes : 0));
+
+        if (progress.isCancelled()) return false;
+
+        outScene = std::move(scene);
+
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).
+            count();
+        Logger::info(std::format("Loaded scene cache {} ({:.1f} MB) in {:.0f} ms.", path,
+                                 static_cast<double>(file.size()) / (1024.0 * 1024.0), ms));
+        return true;
+    }
+
+    bool SceneCache::save(const std::string& sourcePath, const LoadOptions& options, const SfMScene& scene) {
+        const std::string path = cachePath(sourcePath);
+        const std::string tempPath = path + ".tmp";
+
+        const bool lazyFeatures = expectsLazyFeatures(sourcePath, options);
+        if (lazyFeatures != scene.features.isLazy() && !scene.images.empty()) return false;
+
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                Logger::warn("Could not write scene cache: " + path);
+                return false;
+            }
+
+            SectionWriter writer(out);
+            writer.add(CacheSection::Sources, sourceStamps(sourcePath));
+            writer.add(CacheSection::PointPositions, scene.points.positions);
+            writer.add(CacheSection::PointColors, scene.points.colors);
+
+            const bool hasMetadata = scene.metadata.size() == scene.points.size() &&
+                scene.tracks.size() == scene.points.size();
+
+            writer.begin(CacheSection::PointMetadata);
+            if (hasMetadata) writer.append(scene.metadata.data(), scene.metadata.size());
+            writer.begin(CacheSection::TrackOffsets);
+            if (hasMetadata) writer.append(scene.tracks.offsets().data(), scene.tracks.offsets().size());
+            writer.begin(CacheSection::TrackObservations);
+            if (hasMetadata) writer.append(scene.tracks.observations().data(), scene.tracks.observations().size());
+
+            std::vector<CachedCamera> cameras;
+            std::vector<double> cameraParams;
+            cameras.reserve(scene.cameras.size());
+            for (const Camera& cam : scene.cameras) {
+                cameras.push_back({
+                    cam.cameraID, cam.modelId, cam.width, cam.height, cam.focalLength, cam.focalLengthY,
+                    cam.principalPointX, cam.principalPointY, cameraParams.size(), cam.extraParams.size()
+                });
+                cameraParams.insert(cameraParams.end(), cam.extraParams.begin(), cam.extraParams.end());
+            }
+            writer.add(CacheSection::Cameras, cameras);
+            writer.add(CacheSection::CameraParams, cameraParams);
+
+            std::vector<CachedImage> images;
+            std::string imageNames;
+            images.reserve(scene.images.size());
+            for (const CameraPose& img : scene.images) {
+                const glm::quat& q = img.orientation;
+                const std::string_view name = scene.imageNames.get(img.nameId);
+                uint64_t featureOffset = 0, featureCount = 0;
+                scene.features.find(img.imageID, featureOffset, featureCount);
+                images.push_back({
+                    img.imageID, img.cameraID, {img.position.x, img.position.y, img.position.z},
+                    {q.w, q.x, q.y, q.z}, static_cast<uint32_t>(name.size()), imageNames.size(), featureOffset,
+                    featureCount
+                });
+                imageNames += name;
+            }
+            writer.add(CacheSection::Images, images);
+            writer.begin(CacheSection::ImageNames);
+            writer.append(imageNames.data(), imageNames.size());
+
+            const std::span<const glm::vec2> featureCoordinates = scene.features.coordinates();
+            const std::span<const uint32_t> featurePointIndices = scene.features.pointIndices();
+            writer.begin(CacheSection::FeatureCoordinates);
+            if (!lazyFeatures) writer.append(featureCoordinates.data(), featureCoordinates.size());
+            writer.begin(CacheSection::FeaturePointIndices);
+            if (!lazyFeatures) writer.append(featurePointIndices.data(), featurePointIndices.size());
+
+            if (!writer.finish(lazyFeatures ? lazyFeaturesFlag : 0)) {
+                out.close();
+                std::filesystem::remove(tempPath);
+                Logger::warn("Could not write scene cache: " + path);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tempPath, path, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+            Logger::warn("Could not write scene cache: " + path);
+            return false;
+        }
+
+        Logger::info("Wrote scene cache: " + path);
+        return true;
+    }
+}
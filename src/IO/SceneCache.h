@@ -0,0 +1,35 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+
+#include <string>
+
+namespace sfmeditor {
+    class LoadProgress;
+    struct LoadOptions;
+
+    class SceneCache {
+    public:
+        static std::string cachePath(const std::string& sourcePath);
+
+        static bool load(const std::string& sourcePath, const LoadOptions& options, SfMScene& outScene,
+                         LoadProgress& progress);
+        static bool save(const std::string& sourcePath, const LoadOptions& options, const SfMScene& scene);
+    };
+}
@@ -18,20 +18,30 @@
 
 #include "Core/Logger.h"
 
+#include <algorithm>
 #include <fstream>
 #include <filesystem>
-#include <unordered_set>
 #include <unordered_map>
 #include <limits>
+#include <vector>
+#include <cstring>
+#include <bit>
 
 namespace sfmeditor {
-    bool SceneExporter::exportFile(const std::string& filepath, const SfMScene& scene) {
+    bool SceneExporter::exportFile(const std::string& filepath, const SfMScene& scene, const PlyEncoding plyEncoding) {
         const std::filesystem::path path(filepath);
         const std::string ext = path.extension().string();
 
+        if (scene.streamedPoints) {
+            Logger::error("Streamed point clouds cannot be exported; their edits are written back to the node store.");
+            return false;
+        }
+
         if (ext == ".bin") return exportCOLMAP(filepath, scene);
         if (ext == ".txt") return exportCOLMAPText(filepath, scene);
-        if (ext == ".ply") return exportPLY(filepath, scene);
+        if (ext == ".ply") {
+            return plyEncoding == PlyEncoding::Ascii ? exportPLY(filepath, scene) : exportBinaryPLY(filepath, scene);
+        }
         if (ext == ".obj") return exportOBJ(filepath, scene);
         if (ext == ".xyz") return exportXYZ(filepath, scene);
 
@@ -42,18 +52,21 @@ namespace sfmeditor {
     bool SceneExporter::exportCOLMAP(const std::string& filepath, const SfMScene& scene) {
         std::filesystem::path fullPath(filepath);
         std::filesystem::path exportDir = fullPath.parent_path().empty() ? "." : fullPath.parent_path();
-        constexpr uint64_t invalidPoint3DId = std::numeric_limits<uint64_t>::max();
 
-        std::unordered_set<uint64_t> deletedPointIDs;
-        uint64_t actualNumPoints;
-        extractValidPoints(scene, deletedPointIDs, actualNumPoints);
+        if (std::error_code ec; scene.features.isLazy() &&
+            std::filesystem::equivalent(scene.features.lazySourcePath(), exportDir / "images.bin", ec)) {
+            Logger::error("Cannot overwrite images.bin while its features are loaded on demand.");
+            return false;
+        }
+
+        const uint64_t actualNumPoints = countValidPoints(scene);
 
         if (std::ofstream camFile(exportDir / "cameras.bin", std::ios::binary); camFile) {
             uint64_t numCameras = scene.cameras.size();
             camFile.write(reinterpret_cast<const char*>(&numCameras), sizeof(uint64_t));
 
-            for (const auto& [cam_id, camPtr] : scene.cameras) {
-                camFile.write(reinterpret_cast<const char*>(&cam_id), sizeof(uint32_t));
+            for (const Camera& camPtr : scene.cameras) {
+                camFile.write(reinterpret_cast<const char*>(&camPtr.cameraID), sizeof(uint32_t));
                 camFile.write(reinterpret_cast<const char*>(&camPtr.modelId), sizeof(int));
                 camFile.write(reinterpret_cast<const char*>(&camPtr.width), sizeof(uint64_t));
                 camFile.write(reinterpret_cast<const char*>(&camPtr.height), sizeof(uint64_t));
@@ -66,7 +79,8 @@ namespace sfmeditor {
             uint64_t numImages = scene.images.size();
             imgFile.write(reinterpret_cast<const char*>(&numImages), sizeof(uint64_t));
 
-            for (const auto& [image_id, cam] : scene.images) {
+            for (const CameraPose& cam : scene.images) {
+                const uint32_t image_id = cam.imageID;
                 imgFile.write(reinterpret_cast<const char*>(&image_id), sizeof(uint32_t));
 
                 glm::quat q_colmap;
@@ -79,14 +93,17 @@ namespace sfmeditor {
                 imgFile.write(reinterpret_cast<const char*>(extrinsics), 7 * sizeof(double));
 
                 imgFile.write(reinterpret_cast<const char*>(&cam.cameraID), sizeof(uint32_t));
-                imgFile.write(cam.imageName.c_str(), cam.imageName.length() + 1);
+                const std::string_view imageName = scene.imageNames.get(cam.nameId);
+                imgFile.write(imageName.data(), static_cast<std::streamsize>(imageName.size()));
+                imgFile.put('\0');
 
-                uint64_t numPoints2D = cam.features.size();
+                const FeatureView features = scene.features.get(image_id);
+                uint64_t numPoints2D = features.size();
                 imgFile.write(reinterpret_cast<const char*>(&numPoints2D), sizeof(uint64_t));
 
-                for (const auto& feat : cam.features) {
-                    double coords[2] = {feat.coordinates.x, feat.coordinates.y};
-                    uint64_t p3d_id = deletedPointIDs.contains(feat.point3D_id) ? invalidPoint3DId : feat.point3D_id;
+                for (size_t i = 0; i < features.size(); ++i) {
+                    double coords[2] = {features.coordinates[i].x, features.coordinates[i].y};
+                    uint64_t p3d_id = exportedPointId(scene, features.pointIndices[i]);
 
                     imgFile.write(reinterpret_cast<const char*>(coords), 2 * sizeof(double));
                     imgFile.write(reinterpret_cast<const char*>(&p3d_id), sizeof(uint64_t));
@@ -97,33 +114,45 @@ namespace sfmeditor {
         if (std::ofstream ptsFile(exportDir / "points3D.bin", std::ios::binary); ptsFile) {
             ptsFile.write(reinterpret_cast<const char*>(&actualNumPoints), sizeof(uint64_t));
 
-            for (size_t i = 0; i < scene.points.size(); ++i) {
-                const auto& p = scene.points[i];
-                if (p.selected < -0.5f) continue;
+            constexpr size_t blockSize = 4 << 20;
+            std::vector<char> block;
+            block.reserve(blockSize);
+            auto append = [&block](const void* data, const size_t bytes) {
+                const char* src = static_cast<const char*>(data);
+                block.insert(block.end(), src, src + bytes);
+            };
+
+            for (size_t k = 0; k < scene.points.size(); ++k) {
+                const size_t i = fileOrderIndex(scene, k);
+                if (scene.points.isDeleted(i)) continue;
+                const glm::vec3& position = scene.points.positions[i];
+                const glm::vec3& color = scene.points.colors[i];
 
                 const bool hasMeta = (i < scene.metadata.size());
-                uint64_t id = hasMeta ? scene.metadata[i].original_id : (i + 1);
-                const double xyz[3] = {p.position.x, p.position.y, p.position.z};
+                const std::span<const PointObservation> track = (i < scene.tracks.size())
+                                                                    ? scene.tracks[i]
+                                                                    : std::span<const PointObservation>();
+                uint64_t id = hasMeta ? scene.metadata[i].original_id : (k + 1);
+                const double xyz[3] = {position.x, position.y, position.z};
                 const uint8_t rgb[3] = {
-                    static_cast<uint8_t>(p.color.r * 255), static_cast<uint8_t>(p.color.g * 255),
-                    static_cast<uint8_t>(p.color.b * 255)
+                    toColorByte(color.r), toColorByte(color.g), toColorByte(color.b)
                 };
                 double error = hasMeta ? scene.metadata[i].error : 0.0;
-                uint64_t trackLength = hasMeta ? scene.metadata[i].observations.size() : 0;
-
-                ptsFile.write(reinterpret_cast<const char*>(&id), sizeof(uint64_t));
-                ptsFile.write(reinterpret_cast<const char*>(xyz), 3 * sizeof(double));
-                ptsFile.write(reinterpret_cast<const char*>(rgb), 3 * sizeof(uint8_t));
-                ptsFile.write(reinterpret_cast<const char*>(&error), sizeof(double));
-                ptsFile.write(reinterpret_cast<const char*>(&trackLength), sizeof(uint64_t));
-
-                if (hasMeta) {
-                    for (const auto& obs : scene.metadata[i].observations) {
-                        ptsFile.write(reinterpret_cast<const char*>(&obs.image_id), sizeof(uint32_t));
-                        ptsFile.write(reinterpret_cast<const char*>(&obs.point2D_idx), sizeof(uint32_t));
-                    }
+                uint64_t trackLength = track.size();
+
+                append(&id, sizeof(uint64_t));
+                append(xyz, 3 * sizeof(double));
+                append(rgb, 3 * sizeof(uint8_t));
+                append(&error, sizeof(double));
+                append(&trackLength, sizeof(uint64_t));
+                append(track.data(), track.size_bytes());
+
+                if (block.size() >= blockSize) {
+                    ptsFile.write(block.data(), static_cast<std::streamsize>(block.size()));
+                    block.clear();
                 }
             }
+            ptsFile.write(block.data(), static_cast<std::streamsize>(block.size()));
         } else return false;
 
         Logger::info("Full COLMAP Binary Data Exported to directory: " + exportDir.string());
@@ -135,9 +164,7 @@ namespace sfmeditor {
         std::filesystem::path exportDir = fullPath.parent_path().empty() ? "." : fullPath.parent_path();
         constexpr uint64_t invalidPoint3DId = std::numeric_limits<uint64_t>::max();
 
-        std::unordered_set<uint64_t> deletedPointIDs;
-        uint64_t actualNumPoints;
-        extractValidPoints(scene, deletedPointIDs, actualNumPoints);
+        const uint64_t actualNumPoints = countValidPoints(scene);
 
         if (std::ofstream camFile(exportDir / "cameras.txt"); camFile) {
             camFile << "# Camera list with one line of data per camera:\n"
@@ -149,11 +176,11 @@ namespace sfmeditor {
             };
             camFile << std::fixed << std::setprecision(6);
 
-            for (const auto& [cam_id, cam] : scene.cameras) {
+            for (const Camera& cam : scene.cameras) {
                 std::string modelStr = (cam.modelId >= 0 && cam.modelId <= 6)
                                            ? modelNames[cam.modelId]
                                            : "UNKNOWN";
-                camFile << cam_id << " " << modelStr << " " << cam.width << " " << cam.height;
+                camFile << cam.cameraID << " " << modelStr << " " << cam.width << " " << cam.height;
                 for (double param : cam.extraParams) camFile << " " << param;
                 camFile << "\n";
             }
@@ -167,27 +194,27 @@ namespace sfmeditor {
 
             imgFile << std::fixed << std::setprecision(6);
 
-            for (const auto& [image_id, img] : scene.images) {
+            for (const CameraPose& img : scene.images) {
+                const uint32_t image_id = img.imageID;
                 glm::quat q;
                 glm::vec3 t;
                 computeColmapExtrinsics(img, q, t);
 
                 imgFile << image_id << " " << q.w << " " << q.x << " " << q.y << " " << q.z << " "
-                    << t.x << " " << t.y << " " << t.z << " " << img.cameraID << " " << img.imageName << "\n";
+                    << t.x << " " << t.y << " " << t.z << " " << img.cameraID << " "
+                    << scene.imageNames.get(img.nameId) << "\n";
 
-                for (size_t i = 0; i < img.features.size(); ++i) {
-                    uint64_t p3d_id = deletedPointIDs.contains(img.features[i].point3D_id)
-                                          ? invalidPoint3DId
-                                          : img.features[i].point3D_id;
+                const FeatureView features = scene.features.get(image_id);
+                for (size_t i = 0; i < features.size(); ++i) {
+                    const glm::vec2& xy = features.coordinates[i];
+                    uint64_t p3d_id = exportedPointId(scene, features.pointIndices[i]);
 
                     if (p3d_id == invalidPoint3DId)
-                        imgFile << img.features[i].coordinates.x << " " << img.features[i].
-                                                                           coordinates.y << " -1";
+                        imgFile << xy.x << " " << xy.y << " -1";
                     else
-                        imgFile << img.features[i].coordinates.x << " " << img.features[i].coordinates.y << " " <<
-                            p3d_id;
+                        imgFile << xy.x << " " << xy.y << " " << p3d_id;
 
-                    if (i != img.features.size() - 1) imgFile << " ";
+                    if (i != features.size() - 1) imgFile << " ";
                 }
                 imgFile << "\n";
             }
@@ -199,20 +226,22 @@ namespace sfmeditor {
                 << "# Number of points: " << actualNumPoints << "\n";
 
             ptsFile << std::fixed << std::setprecision(6);
-            for (size_t i = 0; i < scene.points.size(); ++i) {
-                const auto& p = scene.points[i];
-                if (p.selected < -0.5f) continue;
+            for (size_t k = 0; k < scene.points.size(); ++k) {
+                const size_t i = fileOrderIndex(scene, k);
+                if (scene.points.isDeleted(i)) continue;
+                const glm::vec3& position = scene.points.positions[i];
+                const glm::vec3& color = scene.points.colors[i];
 
                 const bool hasMeta = (i < scene.metadata.size());
-                uint64_t id = hasMeta ? scene.metadata[i].original_id : (i + 1);
+                uint64_t id = hasMeta ? scene.metadata[i].original_id : (k + 1);
                 double error = hasMeta ? scene.metadata[i].error : 0.0;
 
-                ptsFile << id << " " << p.position.x << " " << p.position.y << " " << p.position.z << " "
-                    << static_cast<int>(p.color.r * 255) << " " << static_cast<int>(p.color.g * 255) << " "
-                    << static_cast<int>(p.color.b * 255) << " " << error;
+                ptsFile << id << " " << position.x << " " << position.y << " " << position.z << " "
+                    << static_cast<int>(toColorByte(color.r)) << " " << static_cast<int>(toColorByte(color.g)) << " "
+                    << static_cast<int>(toColorByte(color.b)) << " " << error;
 
-                if (hasMeta) {
-                    for (const auto& obs : scene.metadata[i].observations) {
+                if (i < scene.tracks.size()) {
+                    for (const auto& obs : scene.tracks[i]) {
                         ptsFile << " " << obs.image_id << " " << obs.point2D_idx;
                     }
                 }
@@ -229,32 +258,82 @@ namespace sfmeditor {
         if (!out) return false;
 
         size_t actualNumPoints = 0;
-        for (const auto& p : scene.points) {
-            if (p.selected >= -0.5f) actualNumPoints++;
+        for (size_t i = 0; i < scene.points.size(); ++i) {
+            if (!scene.points.isDeleted(i)) actualNumPoints++;
         }
 
         out << "ply\nformat ascii 1.0\nelement vertex " << actualNumPoints << "\n"
             << "property float x\nproperty float y\nproperty float z\n"
             << "property uchar red\nproperty uchar green\nproperty uchar blue\nend_header\n";
 
-        for (const auto& p : scene.points) {
-            if (p.selected < -0.5f) continue;
-            out << p.position.x << " " << p.position.y << " " << p.position.z << " "
-                << static_cast<int>(p.color.r * 255) << " " << static_cast<int>(p.color.g * 255) << " "
-                << static_cast<int>(p.color.b * 255) << "\n";
+        for (size_t k = 0; k < scene.points.size(); ++k) {
+            const size_t i = fileOrderIndex(scene, k);
+            if (scene.points.isDeleted(i)) continue;
+            const glm::vec3& position = scene.points.positions[i];
+            const glm::vec3& color = scene.points.colors[i];
+            out << position.x << " " << position.y << " " << position.z << " "
+                << static_cast<int>(toColorByte(color.r)) << " " << static_cast<int>(toColorByte(color.g)) << " "
+                << static_cast<int>(toColorByte(color.b)) << "\n";
         }
         Logger::info("Exported PLY: " + filepath);
         return true;
     }
 
+    bool SceneExporter::exportBinaryPLY(const std::string& filepath, const SfMScene& scene) {
+        static_assert(std::endian::native == std::endian::little, "Binary PLY export assumes a little-endian host.");
+
+        constexpr size_t vertexSize = 3 * sizeof(float) + 3 * sizeof(uint8_t);
+        constexpr size_t verticesPerBlock = 1 << 18;
+
+        std::ofstream out(filepath, std::ios::binary);
+        if (!out) return false;
+
+        out << "ply\nformat binary_little_endian 1.0\nelement vertex " << countValidPoints(scene) << "\n"
+            << "property float x\nproperty float y\nproperty float z\n"
+            << "property uchar red\nproperty uchar green\nproperty uchar blue\nend_header\n";
+
+        std::vector<char> block(verticesPerBlock * vertexSize);
+        size_t blockVertices = 0;
+
+        for (size_t k = 0; k < scene.points.size(); ++k) {
+            const size_t i = fileOrderIndex(scene, k);
+            if (scene.points.isDeleted(i)) continue;
+            const glm::vec3& position = scene.points.positions[i];
+            const glm::vec3& color = scene.points.colors[i];
+
+            char* dst = block.data() + blockVertices * vertexSize;
+            const uint8_t rgb[3] = {
+                toColorByte(color.r), toColorByte(color.g), toColorByte(color.b)
+            };
+            std::memcpy(dst, &position, 3 * sizeof(float));
+            std::memcpy(dst + 3 * sizeof(float), rgb, sizeof(rgb));
+
+            if (++blockVertices == verticesPerBlock) {
+                out.write(block.data(), static_cast<std::streamsize>(blockVertices * vertexSize));
+                blockVertices = 0;
+            }
+        }
+        out.write(block.data(), static_cast<std::streamsize>(blockVertices * vertexSize));
+
+        if (!out) {
+            Logger::error("Failed to write PLY: " + filepath);
+            return false;
+        }
+        Logger::info("Exported binary PLY: " + filepath);
+        return true;
+    }
+
     bool SceneExporter::exportOBJ(const std::string& filepath, const SfMScene& scene) {
         std::ofstream out(filepath);
         if (!out) return false;
         out << "# SFM Editor Export\n";
-        for (const auto& p : scene.points) {
-            if (p.selected < -0.5f) continue;
-            out << "v " << p.position.x << " " << p.position.y << " " << p.position.z << " "
-                << p.color.r << " " << p.color.g << " " << p.color.b << "\n";
+        for (size_t k = 0; k < scene.points.size(); ++k) {
+            const size_t i = fileOrderIndex(scene, k);
+            if (scene.points.isDeleted(i)) continue;
+            const glm::vec3& position = scene.points.positions[i];
+            const glm::vec3& color = scene.points.colors[i];
+            out << "v " << position.x << " " << position.y << " " << position.z << " "
+                << color.r << " " << color.g << " " << color.b << "\n";
         }
         Logger::info("Exported OBJ: " + filepath);
         return true;
@@ -263,31 +342,42 @@ namespace sfmeditor {
     bool SceneExporter::exportXYZ(const std::string& filepath, const SfMScene& scene) {
         std::ofstream out(filepath);
         if (!out) return false;
-        for (const auto& p : scene.points) {
-            if (p.selected < -0.5f) continue;
-            out << p.position.x << " " << p.position.y << " " << p.position.z << " "
-                << static_cast<int>(p.color.r * 255) << " " << static_cast<int>(p.color.g * 255) << " "
-                << static_cast<int>(p.color.b * 255) << "\n";
+        for (size_t k = 0; k < scene.points.size(); ++k) {
+            const size_t i = fileOrderIndex(scene, k);
+            if (scene.points.isDeleted(i)) continue;
+            const glm::vec3& position = scene.points.positions[i];
+            const glm::vec3& color = scene.points.colors[i];
+            out << position.x << " " << position.y << " " << position.z << " "
+                << static_cast<int>(toColorByte(color.r)) << " " << static_cast<int>(toColorByte(color.g)) << " "
+                << static_cast<int>(toColorByte(color.b)) << "\n";
         }
         Logger::info("Exported XYZ: " + filepath);
         return true;
     }
 
-    void SceneExporter::extractValidPoints(const SfMScene& scene, std::unordered_set<uint64_t>& outDeletedIDs,
-                                           uint64_t& outActualNumPoints) {
-        outActualNumPoints = 0;
-        outDeletedIDs.clear();
+    uint64_t SceneExporter::countValidPoints(const SfMScene& scene) {
+        uint64_t count = 0;
+        for (const uint8_t flags : scene.points.flags) {
+            if (!(flags & PointDeleted)) count++;
+        }
+        return count;
+    }
 
-        for (size_t i = 0; i < scene.points.size(); ++i) {
-            const bool hasMeta = (i < scene.metadata.size());
-            uint64_t id = hasMeta ? scene.metadata[i].original_id : (i + 1);
+    uint8_t SceneExporter::toColorByte(const float channel) {
+        // Written so that NaN also maps to 0.
+        const float clamped = channel > 0.0f ? std::min(channel, 1.0f) : 0.0f;
+        return static_cast<uint8_t>(clamped * 255.0f + 0.5f);
+    }
 
-            if (scene.points[i].selected < -0.5f) {
-                outDeletedIDs.insert(id);
-            } else {
-                outActualNumPoints++;
-            }
+    size_t SceneExporter::fileOrderIndex(const SfMScene& scene, const size_t k) {
+        return scene.loadOrder.size() == scene.points.size() ? scene.loadOrder[k] : k;
+    }
+
+    uint64_t SceneExporter::exportedPointId(const SfMScene& scene, const uint32_t pointIndex) {
+        if (pointIndex >= scene.points.size() || scene.points.isDeleted(pointIndex)) {
+            return std::numeric_limits<uint64_t>::max();
         }
+        return pointIndex < scene.metadata.size() ? scene.metadata[pointIndex].original_id : pointIndex + 1;
     }
 
     void SceneExporter::computeColmapExtrinsics(const CameraPose& cam, glm::quat& outQ, glm::vec3& outT) {
@@ -19,24 +19,31 @@
 #include "Core/Types.hpp"
 
 #include <string>
-#include <unordered_set>
 #include <unordered_map>
 
 namespace sfmeditor {
+    enum class PlyEncoding {
+        BinaryLittleEndian,
+        Ascii
+    };
+
     class SceneExporter {
     public:
-        static bool exportFile(const std::string& filepath, const SfMScene& scene);
+        static bool exportFile(const std::string& filepath, const SfMScene& scene,
+                               PlyEncoding plyEncoding = PlyEncoding::BinaryLittleEndian);
 
     private:
         static bool exportCOLMAP(const std::string& filepath, const SfMScene& scene);
         static bool exportCOLMAPText(const std::string& filepath, const SfMScene& scene);
         static bool exportPLY(const std::string& filepath, const SfMScene& scene);
+        static bool exportBinaryPLY(const std::string& filepath, const SfMScene& scene);
         static bool exportOBJ(const std::string& filepath, const SfMScene& scene);
         static bool exportXYZ(const std::string& filepath, const SfMScene& scene);
 
-        static void extractValidPoints(const SfMScene& scene,
-                                       std::unordered_set<uint64_t>& outDeletedIDs,
-                                       uint64_t& outActualNumPoints);
+        static uint64_t countValidPoints(const SfMScene& scene);
+        static uint8_t toColorByte(float channel);
+        static size_t fileOrderIndex(const SfMScene& scene, size_t k);
+        static uint64_t exportedPointId(const SfMScene& scene, uint32_t pointIndex);
 
         static void computeColmapExtrinsics(const CameraPose& cam,
                                             glm::quat& outQ, glm::vec3& outT);
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace sfmeditor {
+    class LineReader {
+    public:
+        explicit LineReader(const std::string_view text)
+            : m_text(text) {
+        }
+
+        bool next(std::string_view& line) {
+            if (m_pos >= m_text.size()) return false;
+
+            size_t end = m_text.find('\n', m_pos);
+            if (end == std::string_view::npos) end = m_text.size();
+
+            line = m_text.substr(m_pos, end - m_pos);
+            if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+            m_pos = end + 1;
+            return true;
+        }
+
+        size_t position() const { return m_pos; }
+
+    private:
+        std::string_view m_text;
+        size_t m_pos = 0;
+    };
+
+    class FieldParser {
+    public:
+        explicit FieldParser(const std::string_view line)
+            : m_cur(line.data()), m_end(line.data() + line.size()) {
+        }
+
+        template <typename T>
+        bool next(T& value) {
+            static_assert(std::is_arithmetic_v<T>);
+            skipWhitespace();
+            if (m_cur >= m_end) return false;
+
+            if constexpr (std::is_unsigned_v<T>) {
+                if (*m_cur == '-') {
+                    std::make_signed_t<T> signedValue;
+                    const auto [ptr, ec] = std::from_chars(m_cur, m_end, signedValue);
+                    if (ec != std::errc()) return false;
+                    value = static_cast<T>(signedValue);
+                    m_cur = ptr;
+                    return true;
+                }
+            }
+
+            if (*m_cur == '+') ++m_cur;
+            const auto [ptr, ec] = std::from_chars(m_cur, m_end, value);
+            if (ec != std::errc()) return false;
+            m_cur = ptr;
+            return true;
+        }
+
+        bool next(std::string_view& token) {
+            skipWhitespace();
+            if (m_cur >= m_end) return false;
+
+            const char* start = m_cur;
+            while (m_cur < m_end && *m_cur != ' ' && *m_cur != '\t') ++m_cur;
+            token = std::string_view(start, m_cur - start);
+            return true;
+        }
+
+        template <typename... T>
+        bool nextAll(T&... values) {
+            return (next(values) && ...);
+        }
+
+    private:
+        void skipWhitespace() {
+            while (m_cur < m_end && (*m_cur == ' ' || *m_cur == '\t')) ++m_cur;
+        }
+
+        const char* m_cur;
+        const char* m_end;
+    };
+}
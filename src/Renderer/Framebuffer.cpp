@@ -35,6 +35,11 @@ namespace sfmeditor {
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_colorAttachment, 0);
 
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_pickingAttachment);
+        glTextureStorage2D(m_pickingAttachment, 1, GL_RG32UI, static_cast<GLsizei>(m_width),
+                           static_cast<GLsizei>(m_height));
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, m_pickingAttachment, 0);
+
         glCreateTextures(GL_TEXTURE_2D, 1, &m_depthAttachment);
         glBindTexture(GL_TEXTURE_2D, m_depthAttachment);
         glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, static_cast<GLsizei>(m_width),
@@ -51,6 +56,7 @@ namespace sfmeditor {
     Framebuffer::~Framebuffer() {
         glDeleteFramebuffers(1, &m_rendererID);
         glDeleteTextures(1, &m_colorAttachment);
+        glDeleteTextures(1, &m_pickingAttachment);
         glDeleteTextures(1, &m_depthAttachment);
     }
 
@@ -63,6 +69,30 @@ namespace sfmeditor {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
     }
 
+    void Framebuffer::beginPicking() const {
+        constexpr GLenum buffers[] = {GL_NONE, GL_COLOR_ATTACHMENT1};
+        glNamedFramebufferDrawBuffers(m_rendererID, 2, buffers);
+
+        constexpr GLuint noPoint[4] = {};
+        glClearNamedFramebufferuiv(m_rendererID, GL_COLOR, 1, noPoint);
+        glClear(GL_DEPTH_BUFFER_BIT);
+    }
+
+    PickedPoint Framebuffer::readPickedID(const int x, const int y) const {
+        if (x < 0 || y < 0 || x >= static_cast<int>(m_width) || y >= static_cast<int>(m_height)) return {};
+
+        GLuint id[2] = {};
+        glNamedFramebufferReadBuffer(m_rendererID, GL_COLOR_ATTACHMENT1);
+        glReadPixels(x, y, 1, 1, GL_RG_INTEGER, GL_UNSIGNED_INT, id);
+        glNamedFramebufferReadBuffer(m_rendererID, GL_COLOR_ATTACHMENT0);
+
+        return {static_cast<int64_t>(id[0]) - 1, static_cast<int64_t>(id[1]) - 1};
+    }
+
+    void Framebuffer::endPicking() const {
+        glNamedFramebufferDrawBuffer(m_rendererID, GL_COLOR_ATTACHMENT0);
+    }
+
     void Framebuffer::resize(const uint32_t width, const uint32_t height) {
         if (width == 0 || height == 0 || (width == m_width && height == m_height)) return;
 
@@ -72,6 +102,7 @@ namespace sfmeditor {
         if (m_rendererID) {
             glDeleteFramebuffers(1, &m_rendererID);
             glDeleteTextures(1, &m_colorAttachment);
+            glDeleteTextures(1, &m_pickingAttachment);
             glDeleteTextures(1, &m_depthAttachment);
         }
 
@@ -86,6 +117,11 @@ namespace sfmeditor {
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_colorAttachment, 0);
 
+        glCreateTextures(GL_TEXTURE_2D, 1, &m_pickingAttachment);
+        glTextureStorage2D(m_pickingAttachment, 1, GL_RG32UI, static_cast<GLsizei>(m_width),
+                           static_cast<GLsizei>(m_height));
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, m_pickingAttachment, 0);
+
         glCreateTextures(GL_TEXTURE_2D, 1, &m_depthAttachment);
         glBindTexture(GL_TEXTURE_2D, m_depthAttachment);
         glTexStorage2D(GL_TEXTURE_2D, 1, GL_DEPTH24_STENCIL8, static_cast<GLsizei>(m_width),
@@ -19,6 +19,12 @@
 #include <cstdint>
 
 namespace sfmeditor {
+    // Streamed clouds also record the store node of the hit, since their point indices restart in every node.
+    struct PickedPoint {
+        int64_t index = -1;
+        int64_t node = -1;
+    };
+
     class Framebuffer {
     public:
         Framebuffer(uint32_t width, uint32_t height);
@@ -34,9 +40,16 @@ namespace sfmeditor {
 
         uint32_t getTextureID() const { return m_colorAttachment; }
 
+        // Point picking writes index + 1 and node + 1 into a separate 32-bit integer attachment, so every index
+        // a uint32 point index can hold stays pickable. Fields are -1 where no point (or no node) was drawn.
+        void beginPicking() const;
+        PickedPoint readPickedID(int x, int y) const;
+        void endPicking() const;
+
     private:
         uint32_t m_rendererID = 0;
         uint32_t m_colorAttachment = 0;
+        uint32_t m_pickingAttachment = 0;
         uint32_t m_depthAttachment = 0;
         uint32_t m_width, m_height;
     };
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "FrustumRenderer.h"
+
+#include <glad/glad.h>
+
+
+namespace sfmeditor {
+    FrustumRenderer::FrustumRenderer() {
+        m_shader = std::make_unique<Shader>("assets/shaders/frustum.vert", "assets/shaders/line.frag");
+
+        glCreateVertexArrays(1, &m_VAO);
+        glVertexArrayBindingDivisor(m_VAO, 0, 1);
+
+        glEnableVertexArrayAttrib(m_VAO, 0);
+        glVertexArrayAttribFormat(m_VAO, 0, 4, GL_FLOAT, GL_FALSE, offsetof(FrustumInstance, positionAspect));
+        glVertexArrayAttribBinding(m_VAO, 0, 0);
+
+        glEnableVertexArrayAttrib(m_VAO, 1);
+        glVertexArrayAttribFormat(m_VAO, 1, 4, GL_FLOAT, GL_FALSE, offsetof(FrustumInstance, orientation));
+        glVertexArrayAttribBinding(m_VAO, 1, 0);
+
+        glEnableVertexArrayAttrib(m_VAO, 2);
+        glVertexArrayAttribIFormat(m_VAO, 2, 1, GL_UNSIGNED_INT, offsetof(FrustumInstance, flags));
+        glVertexArrayAttribBinding(m_VAO, 2, 0);
+    }
+
+    FrustumRenderer::~FrustumRenderer() {
+        if (m_VAO) glDeleteVertexArrays(1, &m_VAO);
+        if (m_instanceBuffer) glDeleteBuffers(1, &m_instanceBuffer);
+    }
+
+    void FrustumRenderer::update(const SfMScene& scene, const SelectionSet& selectedImageIDs,
+                                 const uint64_t revision) {
+        if (revision == m_revision) return;
+        m_revision = revision;
+
+        m_instances.clear();
+        m_instances.reserve(scene.images.size());
+        for (const CameraPose& img : scene.images) {
+            float aspectRatio = 1.0f;
+            if (const Camera* cam = scene.cameras.find(img.cameraID)) {
+                if (cam->height > 0 && cam->width > 0) {
+                    aspectRatio = static_cast<float>(cam->width) / static_cast<float>(cam->height);
+                }
+            }
+
+            const glm::quat& q = img.orientation;
+            m_instances.push_back({
+                glm::vec4(img.position, aspectRatio), glm::vec4(q.x, q.y, q.z, q.w),
+                selectedImageIDs.contains(img.imageID) ? cameraSelected : 0u
+            });
+        }
+        m_instanceCount = static_cast<uint32_t>(m_instances.size());
+        if (m_instances.empty()) return;
+
+        if (m_instances.size() > m_capacity) {
+            if (m_instanceBuffer) glDeleteBuffers(1, &m_instanceBuffer);
+            m_capacity = m_instances.size() + m_instances.size() / 2;
+
+            glCreateBuffers(1, &m_instanceBuffer);
+            glNamedBufferStorage(m_instanceBuffer, static_cast<GLsizeiptr>(m_capacity * sizeof(FrustumInstance)),
+                                 nullptr, GL_DYNAMIC_STORAGE_BIT);
+            glVertexArrayVertexBuffer(m_VAO, 0, m_instanceBuffer, 0, sizeof(FrustumInstance));
+        }
+        glNamedBufferSubData(m_instanceBuffer, 0,
+                             static_cast<GLsizeiptr>(m_instances.size() * sizeof(FrustumInstance)),
+                             m_instances.data());
+    }
+
+    void FrustumRenderer::draw(const SceneProperties* props, const EditorCamera* camera,
+                               const ViewportInfo& viewportInfo) const {
+        if (m_instanceCount == 0) return;
+
+        m_shader->bind();
+        m_shader->setMat4("u_ViewProjection", camera->getViewProjection());
+        m_shader->setFloat("u_CameraSize", props->cameraSize);
+        m_shader->setVec2("u_ViewportSize", viewportInfo.size);
+        m_shader->setFloat("u_CollapsePixels", collapsePixels);
+
+        glBindVertexArray(m_VAO);
+
+        // Eight edges per frustum; frustums that collapsed on screen are skipped here and drawn as points below.
+        m_shader->setBool("u_PointMode", false);
+        glLineWidth(2.0f);
+        glDrawArraysInstanced(GL_LINES, 0, 16, static_cast<GLsizei>(m_instanceCount));
+        glLineWidth(1.0f);
+
+        m_shader->setBool("u_PointMode", true);
+        glDrawArraysInstanced(GL_POINTS, 0, 1, static_cast<GLsizei>(m_instanceCount));
+
+        glBindVertexArray(0);
+        m_shader->unbind();
+    }
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Shader.h"
+#include "Core/SelectionSet.hpp"
+#include "Core/Types.hpp"
+#include "EditorCamera.h"
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+namespace sfmeditor {
+    // Draws one wireframe frustum per image with a single instanced call. Instances are rebuilt only when the
+    // selection manager's camera revision changes; the edges are generated in the vertex shader.
+    class FrustumRenderer {
+    public:
+        FrustumRenderer();
+        ~FrustumRenderer();
+        FrustumRenderer(const FrustumRenderer&) = delete;
+        FrustumRenderer& operator=(const FrustumRenderer&) = delete;
+
+        void update(const SfMScene& scene, const SelectionSet& selectedImageIDs, uint64_t revision);
+        void draw(const SceneProperties* props, const EditorCamera* camera, const ViewportInfo& viewportInfo) const;
+
+    private:
+        struct FrustumInstance {
+            glm::vec4 positionAspect;
+            glm::vec4 orientation;
+            uint32_t flags;
+        };
+
+        static constexpr uint32_t cameraSelected = 1;
+        static constexpr float collapsePixels = 4.0f;
+
+        std::unique_ptr<Shader> m_shader;
+        uint32_t m_VAO = 0;
+        uint32_t m_instanceBuffer = 0;
+        size_t m_capacity = 0;
+        uint32_t m_instanceCount = 0;
+        uint64_t m_revision = UINT64_MAX;
+        std::vector<FrustumInstance> m_instances;
+    };
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PointOctree.h"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+
+
+namespace sfmeditor {
+    namespace {
+        struct BuildTask {
+            uint32_t node;
+            uint32_t first;
+            uint32_t count;
+            glm::vec3 min;
+            glm::vec3 max;
+            uint32_t depth;
+        };
+    }
+
+    void PointOctree::clear() {
+        m_nodes.clear();
+        m_children.clear();
+        m_leafNodes.clear();
+        m_nodeBoundsDirty = false;
+        m_leaves.clear();
+        m_slots.clear();
+        m_pointLeaf.clear();
+    }
+
+    void PointOctree::build(const PointCloud& points, const size_t begin, const size_t count) {
+        clear();
+        if (count == 0) return;
+
+        const glm::vec3* positions = points.positions.data() + begin;
+        m_slots.resize(count);
+        m_pointLeaf.resize(count);
+        std::vector<uint32_t> scratch(count);
+
+        glm::vec3 rootMin(std::numeric_limits<float>::max());
+        glm::vec3 rootMax(std::numeric_limits<float>::lowest());
+        for (uint32_t i = 0; i < count; ++i) {
+            m_slots[i] = i;
+            rootMin = glm::min(rootMin, positions[i]);
+            rootMax = glm::max(rootMax, positions[i]);
+        }
+
+        m_nodes.push_back({});
+        std::vector<BuildTask> stack;
+        stack.push_back({0, 0, static_cast<uint32_t>(count), rootMin, rootMax, 0});
+
+        while (!stack.empty()) {
+            const BuildTask task = stack.back();
+            stack.pop_back();
+
+            if (task.count <= maxLeafPoints || task.depth >= maxDepth) {
+                const auto leafIndex = static_cast<uint32_t>(m_leaves.size());
+                const auto first = m_slots.begin() + task.first;
+                std::shuffle(first, first + task.count, std::minstd_rand(leafIndex + 1));
+
+                OctreeLeaf leaf{
+                    glm::vec3(std::numeric_limits<float>::max()), glm::vec3(std::numeric_limits<float>::lowest()),
+                    task.first, task.count
+                };
+                for (uint32_t s = task.first; s < task.first + task.count; ++s) {
+                    leaf.min = glm::min(leaf.min, positions[m_slots[s]]);
+                    leaf.max = glm::max(leaf.max, positions[m_slots[s]]);
+                    m_pointLeaf[m_slots[s]] = leafIndex;
+                }
+                m_leaves.push_back(leaf);
+                m_leafNodes.push_back(task.node);
+                m_nodes[task.node] = {leaf.min, leaf.max, 0, 0, leafIndex, 1};
+                continue;
+            }
+
+            const glm::vec3 center = (task.min + task.max) * 0.5f;
+            auto octant = [&](const uint32_t slot) {
+                const glm::vec3& p = positions[slot];
+                return (p.x > center.x ? 1u : 0u) | (p.y > center.y ? 2u : 0u) | (p.z > center.z ? 4u : 0u);
+            };
+
+            std::array<uint32_t, 9> offsets{};
+            for (uint32_t s = task.first; s < task.first + task.count; ++s) ++offsets[octant(m_slots[s]) + 1];
+            for (int c = 0; c < 8; ++c) offsets[c + 1] += offsets[c];
+
+            std::array<uint32_t, 8> cursor{};
+            for (int c = 0; c < 8; ++c) cursor[c] = task.first + offsets[c];
+            for (uint32_t s = task.first; s < task.first + task.count; ++s) {
+                scratch[cursor[octant(m_slots[s])]++] = m_slots[s];
+            }
+            std::copy(scratch.begin() + task.first, scratch.begin() + task.first + task.count,
+                      m_slots.begin() + task.first);
+
+            const auto firstChild = static_cast<uint32_t>(m_children.size());
+            uint32_t childCount = 0;
+            // Children are pushed in reverse so leaves come out in octant order.
+            for (int c = 7; c >= 0; --c) {
+                const uint32_t octantCount = offsets[c + 1] - offsets[c];
+                if (octantCount == 0) continue;
+
+                const glm::vec3 childMin((c & 1) ? center.x : task.min.x, (c & 2) ? center.y : task.min.y,
+                                         (c & 4) ? center.z : task.min.z);
+                const glm::vec3 childMax((c & 1) ? task.max.x : center.x, (c & 2) ? task.max.y : center.y,
+                                         (c & 4) ? task.max.z : center.z);
+
+                const auto child = static_cast<uint32_t>(m_nodes.size());
+                m_nodes.push_back({});
+                m_children.push_back(child);
+                ++childCount;
+                stack.push_back({child, task.first + offsets[c], octantCount, childMin, childMax, task.depth + 1});
+            }
+            m_nodes[task.node].firstChild = firstChild;
+            m_nodes[task.node].childCount = childCount;
+        }
+
+        m_nodeBoundsDirty = true;
+        refreshNodeBounds();
+    }
+
+    void PointOctree::refreshNodeBounds() {
+        if (!m_nodeBoundsDirty) return;
+
+        for (uint32_t leaf = 0; leaf < m_leaves.size(); ++leaf) {
+            m_nodes[m_leafNodes[leaf]].min = m_leaves[leaf].min;
+            m_nodes[m_leafNodes[leaf]].max = m_leaves[leaf].max;
+        }
+
+        // Children always have larger indices than their parent, so a reverse sweep sees them first.
+        for (size_t n = m_nodes.size(); n-- > 0;) {
+            OctreeNode& node = m_nodes[n];
+            if (node.childCount == 0) continue;
+
+            node.min = glm::vec3(std::numeric_limits<float>::max());
+            node.max = glm::vec3(std::numeric_limits<float>::lowest());
+            node.firstLeaf = std::numeric_limits<uint32_t>::max();
+            node.leafCount = 0;
+            for (const uint32_t child : children(node)) {
+                node.min = glm::min(node.min, m_nodes[child].min);
+                node.max = glm::max(node.max, m_nodes[child].max);
+                node.firstLeaf = std::min(node.firstLeaf, m_nodes[child].firstLeaf);
+                node.leafCount += m_nodes[child].leafCount;
+            }
+        }
+        m_nodeBoundsDirty = false;
+    }
+}
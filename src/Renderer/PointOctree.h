@@ -0,0 +1,82 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Core/PointCloud.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace sfmeditor {
+    struct OctreeLeaf {
+        glm::vec3 min;
+        glm::vec3 max;
+        uint32_t firstSlot;
+        uint32_t count;
+    };
+
+    // Nodes are stored parents-first; the leaves below a node form the contiguous run [firstLeaf, +leafCount).
+    struct OctreeNode {
+        glm::vec3 min;
+        glm::vec3 max;
+        uint32_t firstChild;
+        uint32_t childCount;
+        uint32_t firstLeaf;
+        uint32_t leafCount;
+    };
+
+    // Octree over a contiguous range of points. Leaf points are stored contiguously in slot order as indices
+    // relative to the start of the range, shuffled within each leaf so that any prefix is a uniform subsample.
+    class PointOctree {
+    public:
+        static constexpr uint32_t maxLeafPoints = 4096;
+        static constexpr uint32_t maxDepth = 16;
+
+        void build(const PointCloud& points, size_t begin, size_t count);
+        void clear();
+
+        const std::vector<OctreeLeaf>& leaves() const { return m_leaves; }
+        const std::vector<OctreeNode>& nodes() const { return m_nodes; }
+        std::span<const uint32_t> children(const OctreeNode& node) const {
+            return {m_children.data() + node.firstChild, node.childCount};
+        }
+        std::span<const uint32_t> leafPoints(const uint32_t leaf) const {
+            return {m_slots.data() + m_leaves[leaf].firstSlot, m_leaves[leaf].count};
+        }
+        uint32_t leafOf(const size_t localIndex) const { return m_pointLeaf[localIndex]; }
+        uint32_t leafNode(const uint32_t leaf) const { return m_leafNodes[leaf]; }
+
+        void expandBounds(const uint32_t leaf, const glm::vec3& position) {
+            m_leaves[leaf].min = glm::min(m_leaves[leaf].min, position);
+            m_leaves[leaf].max = glm::max(m_leaves[leaf].max, position);
+            m_nodeBoundsDirty = true;
+        }
+
+        void refreshNodeBounds();
+
+    private:
+        std::vector<OctreeNode> m_nodes;
+        std::vector<uint32_t> m_children;
+        std::vector<uint32_t> m_leafNodes;
+        bool m_nodeBoundsDirty = false;
+        std::vector<OctreeLeaf> m_leaves;
+        std::vector<uint32_t> m_slots;
+        std::vector<uint32_t> m_pointLeaf;
+    };
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "PointQuantizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SFM_QUANTIZER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+
+namespace sfmeditor {
+    namespace {
+        glm::vec3 inverseScale(const ChunkBounds& bounds) {
+            const glm::vec3 scale(bounds.scale);
+            return {
+                scale.x > 0.0f ? 1.0f / scale.x : 0.0f,
+                scale.y > 0.0f ? 1.0f / scale.y : 0.0f,
+                scale.z > 0.0f ? 1.0f / scale.z : 0.0f
+            };
+        }
+
+        uint32_t quantize(const float value, const float min, const float invScale) {
+            constexpr auto maxQ = static_cast<float>(PointQuantizer::maxQuantized);
+            return static_cast<uint32_t>(std::lrint(std::clamp((value - min) * invScale, 0.0f, maxQ)));
+        }
+
+        uint32_t quantizeColor(const float value) {
+            return static_cast<uint32_t>(std::lrint(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+        }
+
+        void packPoint(const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t color,
+                       CompactPointVertex& out) {
+            out.packedPosition[0] = x | (y << 21);
+            out.packedPosition[1] = (y >> 11) | (z << 10);
+            out.color = color;
+        }
+
+#ifdef SFM_QUANTIZER_SSE2
+        // Loads four consecutive vec3 values and transposes them into x, y and z lanes.
+        void loadTransposed(const glm::vec3* src, __m128& x, __m128& y, __m128& z) {
+            const float* f = &src[0].x;
+            const __m128 a = _mm_loadu_ps(f);
+            const __m128 b = _mm_loadu_ps(f + 4);
+            const __m128 c = _mm_loadu_ps(f + 8);
+
+            x = _mm_shuffle_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 3, 0, 0)),
+                               _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+            y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)),
+                               _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+            z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)),
+                               _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+        }
+
+        __m128i quantizeLanes(const __m128 value, const __m128 min, const __m128 invScale, const __m128 maxQ) {
+            const __m128 q = _mm_mul_ps(_mm_sub_ps(value, min), invScale);
+            return _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(q, _mm_setzero_ps()), maxQ));
+        }
+#endif
+    }
+
+    ChunkBounds PointQuantizer::computeBounds(const PointCloud& points, const size_t begin, const size_t count) {
+        glm::vec3 lo(std::numeric_limits<float>::max());
+        glm::vec3 hi(std::numeric_limits<float>::lowest());
+        for (size_t i = begin; i < begin + count; ++i) {
+            lo = glm::min(lo, points.positions[i]);
+            hi = glm::max(hi, points.positions[i]);
+        }
+        if (count == 0) lo = hi = glm::vec3(0.0f);
+
+        return {glm::vec4(lo, 0.0f), glm::vec4((hi - lo) / static_cast<float>(maxQuantized), 0.0f)};
+    }
+
+    void PointQuantizer::encodeScalar(const PointCloud& points, const size_t begin, const size_t count,
+                                      const ChunkBounds& bounds, CompactPointVertex* out) {
+        const glm::vec3 min(bounds.min);
+        const glm::vec3 inv = inverseScale(bounds);
+
+        for (size_t i = 0; i < count; ++i) {
+            const glm::vec3& p = points.positions[begin + i];
+            const glm::vec3& c = points.colors[begin + i];
+            const uint32_t color = quantizeColor(c.r) | (quantizeColor(c.g) << 8) | (quantizeColor(c.b) << 16) |
+                                   0xFF000000u;
+            packPoint(quantize(p.x, min.x, inv.x), quantize(p.y, min.y, inv.y), quantize(p.z, min.z, inv.z), color,
+                      out[i]);
+        }
+    }
+
+    void PointQuantizer::encode(const PointCloud& points, const size_t begin, const size_t count,
+                                const ChunkBounds& bounds, CompactPointVertex* out) {
+#ifdef SFM_QUANTIZER_SSE2
+        const glm::vec3 inv = inverseScale(bounds);
+        const __m128 minX = _mm_set1_ps(bounds.min.x), minY = _mm_set1_ps(bounds.min.y);
+        const __m128 minZ = _mm_set1_ps(bounds.min.z);
+        const __m128 invX = _mm_set1_ps(inv.x), invY = _mm_set1_ps(inv.y), invZ = _mm_set1_ps(inv.z);
+        const __m128 maxQ = _mm_set1_ps(static_cast<float>(maxQuantized));
+        const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), colorScale = _mm_set1_ps(255.0f);
+        const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128 px, py, pz, cr, cg, cb;
+            loadTransposed(&points.positions[begin + i], px, py, pz);
+            loadTransposed(&points.colors[begin + i], cr, cg, cb);
+
+            const __m128i qx = quantizeLanes(px, minX, invX, maxQ);
+            const __m128i qy = quantizeLanes(py, minY, invY, maxQ);
+            const __m128i qz = quantizeLanes(pz, minZ, invZ, maxQ);
+
+            const __m128i r = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(cr, zero), one), colorScale));
+            const __m128i g = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(cg, zero), one), colorScale));
+            const __m128i b = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(cb, zero), one), colorScale));
+
+            alignas(16) uint32_t lo[4], hi[4], rgba[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(lo), _mm_or_si128(qx, _mm_slli_epi32(qy, 21)));
+            _mm_store_si128(reinterpret_cast<__m128i*>(hi), _mm_or_si128(_mm_srli_epi32(qy, 11),
+                                                                         _mm_slli_epi32(qz, 10)));
+            _mm_store_si128(reinterpret_cast<__m128i*>(rgba),
+                            _mm_or_si128(_mm_or_si128(r, _mm_slli_epi32(g, 8)),
+                                         _mm_or_si128(_mm_slli_epi32(b, 16), alpha)));
+
+            for (int k = 0; k < 4; ++k) {
+                out[i + k].packedPosition[0] = lo[k];
+                out[i + k].packedPosition[1] = hi[k];
+                out[i + k].color = rgba[k];
+            }
+        }
+        encodeScalar(points, begin + i, count - i, bounds, out + i);
+#else
+        encodeScalar(points, begin, count, bounds, out);
+#endif
+    }
+}
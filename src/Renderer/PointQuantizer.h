@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Core/PointCloud.hpp"
+
+#include <cstdint>
+
+namespace sfmeditor {
+    // Compact GPU vertex: 21-bit positions relative to the owning chunk's bounds, packed into two words,
+    // followed by an RGBA8 color. The flags byte lives in its own buffer as in the full-precision layout.
+    struct CompactPointVertex {
+        uint32_t packedPosition[2];
+        uint32_t color;
+    };
+
+    // Per-chunk dequantization parameters as laid out in the shader storage buffer: position = min + q * scale.
+    struct ChunkBounds {
+        glm::vec4 min;
+        glm::vec4 scale;
+    };
+
+    class PointQuantizer {
+    public:
+        static constexpr uint32_t chunkShift = 16;
+        static constexpr size_t chunkSize = size_t(1) << chunkShift;
+        static constexpr uint32_t positionBits = 21;
+        static constexpr uint32_t maxQuantized = (1u << positionBits) - 1;
+
+        static size_t chunkCount(const size_t pointCount) { return (pointCount + chunkSize - 1) >> chunkShift; }
+
+        static ChunkBounds computeBounds(const PointCloud& points, size_t begin, size_t count);
+        static void encode(const PointCloud& points, size_t begin, size_t count, const ChunkBounds& bounds,
+                           CompactPointVertex* out);
+        static void encodeScalar(const PointCloud& points, size_t begin, size_t count, const ChunkBounds& bounds,
+                                 CompactPointVertex* out);
+    };
+}
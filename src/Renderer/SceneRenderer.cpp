@@ -21,127 +21,485 @@
 
 #include <glad/glad.h>
 #include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cstring>
 #include <format>
+#include <limits>
 
 
 namespace sfmeditor {
     SceneRenderer::SceneRenderer() {
         m_pointShader = std::make_unique<Shader>("assets/shaders/basic.vert", "assets/shaders/basic.frag");
         m_pickingShader = std::make_unique<Shader>("assets/shaders/picking.vert", "assets/shaders/picking.frag");
+        m_compactPointShader = std::make_unique<Shader>("assets/shaders/basic_compact.vert",
+                                                        "assets/shaders/basic.frag");
+        m_compactPickingShader = std::make_unique<Shader>("assets/shaders/picking_compact.vert",
+                                                          "assets/shaders/picking.frag");
         m_postProcessShader = std::make_unique<Shader>("assets/shaders/postprocess.vert",
                                                        "assets/shaders/postprocess.frag");
+        m_staging.init(stagingRegionBytes);
     }
 
     SceneRenderer::~SceneRenderer() {
-        if (m_VAO)
-            glDeleteVertexArrays(1, &m_VAO);
-        if (m_VBO)
-            glDeleteBuffers(1, &m_VBO);
+        releasePointBuffers();
+        endPreview();
     }
 
-    void SceneRenderer::initBuffers(const std::vector<Point>& points) {
-        if (m_VAO) {
-            glDeleteVertexArrays(1, &m_VAO);
-            m_VAO = 0;
+    void SceneRenderer::releasePointBuffers() {
+        for (PointSegment& segment : m_segments) {
+            glDeleteVertexArrays(1, &segment.vao);
+            const uint32_t buffers[] = {segment.vbo, segment.flagsVbo, segment.indexBuffer, segment.indirectBuffer};
+            glDeleteBuffers(4, buffers);
         }
-        if (m_VBO) {
-            glDeleteBuffers(1, &m_VBO);
-            m_VBO = 0;
+        m_segments.clear();
+
+        if (m_boundsSSBO) {
+            glDeleteBuffers(1, &m_boundsSSBO);
+            m_boundsSSBO = 0;
         }
+        m_chunkBounds.clear();
+    }
 
-        glCreateVertexArrays(1, &m_VAO);
-        glCreateBuffers(1, &m_VBO);
+    void SceneRenderer::initBuffers(const PointCloud& points, const bool compact) {
+        releasePointBuffers();
+        m_compact = compact;
+        if (points.empty()) return;
+        if (points.size() > UINT32_MAX) {
+            Logger::error(std::format("Cannot upload {} points: point indices are limited to 32 bits.",
+                                      points.size()));
+            return;
+        }
 
-        glBindVertexArray(m_VAO);
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        if (compact) {
+            m_chunkBounds.assign(PointQuantizer::chunkCount(points.size()), ChunkBounds{});
+            glCreateBuffers(1, &m_boundsSSBO);
+            glNamedBufferStorage(m_boundsSSBO, static_cast<GLsizeiptr>(m_chunkBounds.size() * sizeof(ChunkBounds)),
+                                 nullptr, GL_DYNAMIC_STORAGE_BIT);
+        }
 
-        glBufferData(GL_ARRAY_BUFFER, points.size() * sizeof(Point), points.data(), GL_DYNAMIC_DRAW);
+        const size_t vertexSize = compact ? sizeof(CompactPointVertex) : sizeof(PointVertex);
+        for (size_t begin = 0; begin < points.size(); begin += segmentSize) {
+            PointSegment& segment = m_segments.emplace_back();
+            segment.begin = begin;
+            segment.count = std::min(segmentSize, points.size() - begin);
+            segment.octree.build(points, begin, segment.count);
+
+            const size_t leafCount = segment.octree.leaves().size();
+            segment.leafVisibleCounts.assign(leafCount, 0);
+            segment.dirtyLeaves.assign(leafCount, 1);
+            segment.hasDirtyLeaves = true;
+
+            glCreateVertexArrays(1, &segment.vao);
+            glCreateBuffers(1, &segment.vbo);
+            glCreateBuffers(1, &segment.flagsVbo);
+            glCreateBuffers(1, &segment.indexBuffer);
+            glCreateBuffers(1, &segment.indirectBuffer);
+            // Dynamic storage only backs the glNamedBufferSubData fallback in stageUpload.
+            constexpr GLbitfield storage = GL_DYNAMIC_STORAGE_BIT;
+            glNamedBufferStorage(segment.vbo, static_cast<GLsizeiptr>(segment.count * vertexSize), nullptr, storage);
+            glNamedBufferStorage(segment.flagsVbo, static_cast<GLsizeiptr>(segment.count), nullptr, storage);
+            glNamedBufferStorage(segment.indexBuffer, static_cast<GLsizeiptr>(segment.count * sizeof(uint32_t)),
+                                 nullptr, storage);
+            glNamedBufferStorage(segment.indirectBuffer,
+                                 static_cast<GLsizeiptr>(leafCount * sizeof(DrawElementsIndirectCommand)), nullptr,
+                                 storage);
+            glVertexArrayElementBuffer(segment.vao, segment.indexBuffer);
+
+            glBindVertexArray(segment.vao);
+            glBindBuffer(GL_ARRAY_BUFFER, segment.vbo);
+            if (compact) configureCompactPointAttributes();
+            else configurePointAttributes();
+
+            glBindBuffer(GL_ARRAY_BUFFER, segment.flagsVbo);
+            glEnableVertexAttribArray(2);
+            glVertexAttribIPointer(2, 1, GL_UNSIGNED_BYTE, sizeof(uint8_t), nullptr);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        glBindVertexArray(0);
 
-        glEnableVertexAttribArray(0);
-        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Point), nullptr);
+        if (compact) uploadCompactChunks(points, 0, PointQuantizer::chunkCount(points.size()));
+        else uploadVertices(points, 0, points.size());
+        uploadFlags(points, 0, points.size());
+        for (PointSegment& segment : m_segments) rebuildDirtyLeaves(points, segment);
+        m_staging.submit();
+    }
 
-        glEnableVertexAttribArray(1);
-        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Point),
-                              reinterpret_cast<const void*>(offsetof(Point, color)));
+    template <typename Fill>
+    void SceneRenderer::stageUpload(const uint32_t buffer, const size_t dstOffset, const size_t bytes, Fill&& fill) {
+        size_t stagingOffset = 0;
+        if (void* dst = m_staging.allocate(bytes, stagingOffset)) {
+            const size_t written = fill(dst);
+            if (written > 0) m_staging.copyTo(buffer, stagingOffset, dstOffset, written);
+            return;
+        }
 
-        glEnableVertexAttribArray(2);
-        glVertexAttribPointer(2, 1, GL_FLOAT, GL_FALSE, sizeof(Point),
-                              reinterpret_cast<const void*>(offsetof(Point, selected)));
+        m_uploadScratch.resize(bytes);
+        const size_t written = fill(m_uploadScratch.data());
+        if (written > 0) {
+            glNamedBufferSubData(buffer, static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(written),
+                                 m_uploadScratch.data());
+        }
+    }
 
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    void SceneRenderer::uploadVertices(const PointCloud& points, const size_t begin, const size_t count) {
+        constexpr size_t uploadBatch = stagingRegionBytes / sizeof(PointVertex);
+
+        for (size_t offset = 0; offset < count;) {
+            const size_t index = begin + offset;
+            const PointSegment& segment = m_segments[index >> segmentShift];
+            const size_t batch = std::min({uploadBatch, count - offset, segment.begin + segment.count - index});
+            const size_t bytes = batch * sizeof(PointVertex);
+
+            stageUpload(segment.vbo, (index - segment.begin) * sizeof(PointVertex), bytes, [&](void* dst) {
+                points.packVertices(index, batch, static_cast<PointVertex*>(dst));
+                return bytes;
+            });
+            offset += batch;
+        }
     }
 
-    void SceneRenderer::updateBuffers(std::vector<Point>& points, EditorSystem* editorSystem) {
-        if (points.empty()) return;
+    void SceneRenderer::uploadCompactChunks(const PointCloud& points, const size_t firstChunk, const size_t endChunk) {
+        static_assert(PointQuantizer::chunkSize * sizeof(CompactPointVertex) <= stagingRegionBytes);
+
+        for (size_t chunk = firstChunk; chunk < endChunk; ++chunk) {
+            const size_t begin = chunk << PointQuantizer::chunkShift;
+            const size_t count = std::min(PointQuantizer::chunkSize, points.size() - begin);
+            const size_t bytes = count * sizeof(CompactPointVertex);
+            const PointSegment& segment = m_segments[begin >> segmentShift];
+
+            m_chunkBounds[chunk] = PointQuantizer::computeBounds(points, begin, count);
+
+            stageUpload(segment.vbo, (begin - segment.begin) * sizeof(CompactPointVertex), bytes, [&](void* dst) {
+                PointQuantizer::encode(points, begin, count, m_chunkBounds[chunk],
+                                       static_cast<CompactPointVertex*>(dst));
+                return bytes;
+            });
+        }
+
+        if (firstChunk < endChunk) {
+            glNamedBufferSubData(m_boundsSSBO, static_cast<GLintptr>(firstChunk * sizeof(ChunkBounds)),
+                                 static_cast<GLsizeiptr>((endChunk - firstChunk) * sizeof(ChunkBounds)),
+                                 &m_chunkBounds[firstChunk]);
+        }
+    }
+
+    void SceneRenderer::uploadFlags(const PointCloud& points, const size_t begin, const size_t count) {
+        constexpr size_t uploadBatch = stagingRegionBytes;
+
+        for (size_t offset = 0; offset < count;) {
+            const size_t index = begin + offset;
+            const PointSegment& segment = m_segments[index >> segmentShift];
+            const size_t batch = std::min({uploadBatch, count - offset, segment.begin + segment.count - index});
+
+            stageUpload(segment.flagsVbo, index - segment.begin, batch, [&](void* dst) {
+                std::memcpy(dst, points.flags.data() + index, batch);
+                return batch;
+            });
+            offset += batch;
+        }
+    }
 
-        glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    void SceneRenderer::markLeavesDirty(const size_t begin, const size_t count) {
+        for (size_t i = begin; i < begin + count; ++i) {
+            PointSegment& segment = m_segments[i >> segmentShift];
+            segment.dirtyLeaves[segment.octree.leafOf(i - segment.begin)] = 1;
+            segment.hasDirtyLeaves = true;
+        }
+    }
 
-        const size_t totalPoints = points.size();
-        const float threshold = totalPoints * m_thresholdFactor;
+    void SceneRenderer::expandLeafBounds(const PointCloud& points, const size_t begin, const size_t count) {
+        for (size_t i = begin; i < begin + count; ++i) {
+            PointSegment& segment = m_segments[i >> segmentShift];
+            segment.octree.expandBounds(segment.octree.leafOf(i - segment.begin), points.positions[i]);
+        }
+    }
 
-        auto& changed = editorSystem->getSelectionManager()->changedIndices;
+    void SceneRenderer::rebuildDirtyLeaves(const PointCloud& points, PointSegment& segment) {
+        if (!segment.hasDirtyLeaves) return;
+
+        constexpr size_t uploadBatch = stagingRegionBytes / sizeof(uint32_t);
+        const auto& leaves = segment.octree.leaves();
+        for (uint32_t leaf = 0; leaf < leaves.size(); ++leaf) {
+            if (!segment.dirtyLeaves[leaf]) continue;
+            segment.dirtyLeaves[leaf] = 0;
+
+            const std::span<const uint32_t> slots = segment.octree.leafPoints(leaf);
+            uint32_t visible = 0;
+            for (size_t offset = 0; offset < slots.size(); offset += uploadBatch) {
+                const size_t batch = std::min(uploadBatch, slots.size() - offset);
+
+                uint32_t written = 0;
+                stageUpload(segment.indexBuffer, (leaves[leaf].firstSlot + visible) * sizeof(uint32_t),
+                            batch * sizeof(uint32_t), [&](void* dst) {
+                                auto* indices = static_cast<uint32_t*>(dst);
+                                for (size_t k = offset; k < offset + batch; ++k) {
+                                    if (points.isVisible(segment.begin + slots[k])) indices[written++] = slots[k];
+                                }
+                                return written * sizeof(uint32_t);
+                            });
+                visible += written;
+            }
+            segment.leafVisibleCounts[leaf] = visible;
+        }
+        segment.hasDirtyLeaves = false;
+
+        segment.visiblePrefix.resize(leaves.size() + 1);
+        segment.visiblePrefix[0] = 0;
+        for (size_t leaf = 0; leaf < leaves.size(); ++leaf) {
+            segment.visiblePrefix[leaf + 1] = segment.visiblePrefix[leaf] + segment.leafVisibleCounts[leaf];
+        }
+    }
+
+    void SceneRenderer::selectLevelOfDetail(const Frustum& frustum, const glm::vec3& eye, const size_t budget) {
+        // Nodes are refined coarse-to-fine in order of projected size while the budget allows. An accepted node
+        // draws the same fraction of every leaf below it; the shuffled leaf prefixes make that a uniform sample.
+        auto projectedSize = [&](const OctreeNode& node) {
+            const float radius = glm::length(node.max - node.min) * 0.5f;
+            const float distance = glm::length((node.min + node.max) * 0.5f - eye);
+            return distance > radius ? radius / distance : std::numeric_limits<float>::max();
+        };
+
+        m_lodQueue.clear();
+        for (uint32_t s = 0; s < m_segments.size(); ++s) {
+            PointSegment& segment = m_segments[s];
+            segment.nodeFractions.assign(segment.octree.nodes().size(), -1.0f);
+
+            const OctreeNode& root = segment.octree.nodes()[0];
+            if (frustum.intersects(root.min, root.max)) m_lodQueue.push_back({projectedSize(root), s, 0, 0.0f});
+        }
+        std::make_heap(m_lodQueue.begin(), m_lodQueue.end());
+
+        auto remaining = static_cast<double>(budget);
+        while (!m_lodQueue.empty()) {
+            std::pop_heap(m_lodQueue.begin(), m_lodQueue.end());
+            const LodCandidate candidate = m_lodQueue.back();
+            m_lodQueue.pop_back();
+
+            PointSegment& segment = m_segments[candidate.segment];
+            const OctreeNode& node = segment.octree.nodes()[candidate.node];
+            const uint64_t visible = segment.visiblePrefix[node.firstLeaf + node.leafCount] -
+                                     segment.visiblePrefix[node.firstLeaf];
+            if (visible == 0) continue;
+
+            const float fraction = node.childCount == 0
+                                       ? 1.0f
+                                       : std::min(1.0f, static_cast<float>(PointOctree::maxLeafPoints) /
+                                                        static_cast<float>(visible));
+            const double cost = (fraction - candidate.parentFraction) * static_cast<double>(visible);
+            if (cost > remaining) continue;
+
+            remaining -= cost;
+            segment.nodeFractions[candidate.node] = fraction;
+            if (fraction >= 1.0f) continue;
+
+            for (const uint32_t child : segment.octree.children(node)) {
+                const OctreeNode& childNode = segment.octree.nodes()[child];
+                if (!frustum.intersects(childNode.min, childNode.max)) continue;
+                m_lodQueue.push_back({projectedSize(childNode), candidate.segment, child, fraction});
+                std::push_heap(m_lodQueue.begin(), m_lodQueue.end());
+            }
+        }
 
-        if (!changed.empty()) {
-            if (changed.size() < threshold) {
-                for (const unsigned int idx : changed) {
-                    glBufferSubData(GL_ARRAY_BUFFER, idx * sizeof(Point), sizeof(Point), &points[idx]);
+        // Nodes that were not accepted inherit the fraction of their nearest accepted ancestor.
+        for (PointSegment& segment : m_segments) {
+            const auto& nodes = segment.octree.nodes();
+            if (segment.nodeFractions[0] < 0.0f) segment.nodeFractions[0] = 0.0f;
+            for (size_t n = 0; n < nodes.size(); ++n) {
+                for (const uint32_t child : segment.octree.children(nodes[n])) {
+                    if (segment.nodeFractions[child] < 0.0f) segment.nodeFractions[child] = segment.nodeFractions[n];
                 }
-            } else {
-                glBufferSubData(GL_ARRAY_BUFFER, 0, totalPoints * sizeof(Point), points.data());
             }
-            changed.clear();
         }
+    }
+
+    void SceneRenderer::drawVisiblePoints(const Shader& shader, const SceneProperties* props,
+                                          const EditorCamera* camera, const bool applyBudget) {
+        const Frustum frustum(camera->getViewProjection());
+        const bool useBudget = applyBudget && props->limitPointBudget && props->pointBudget > 0;
+        if (useBudget) selectLevelOfDetail(frustum, camera->position, static_cast<size_t>(props->pointBudget));
+
+        for (const PointSegment& segment : m_segments) {
+            // A fully visible leaf ends where the next leaf's slots begin, so consecutive leaves share a command.
+            m_drawCommands.clear();
+            const auto& leaves = segment.octree.leaves();
+            for (uint32_t leaf = 0; leaf < leaves.size(); ++leaf) {
+                uint32_t visible = segment.leafVisibleCounts[leaf];
+                if (useBudget) {
+                    const float fraction = segment.nodeFractions[segment.octree.leafNode(leaf)];
+                    visible = std::min(visible, static_cast<uint32_t>(std::ceil(visible * fraction)));
+                }
+                if (visible == 0 || !frustum.intersects(leaves[leaf].min, leaves[leaf].max)) continue;
+
+                if (!m_drawCommands.empty()) {
+                    DrawElementsIndirectCommand& last = m_drawCommands.back();
+                    if (last.firstIndex + last.count == leaves[leaf].firstSlot) {
+                        last.count += visible;
+                        continue;
+                    }
+                }
+                m_drawCommands.push_back({visible, 1, leaves[leaf].firstSlot, 0, 0});
+            }
+            if (m_drawCommands.empty()) continue;
+
+            const size_t bytes = m_drawCommands.size() * sizeof(DrawElementsIndirectCommand);
+            stageUpload(segment.indirectBuffer, 0, bytes, [&](void* dst) {
+                std::memcpy(dst, m_drawCommands.data(), bytes);
+                return bytes;
+            });
+
+            shader.setUInt("u_BaseIndex", static_cast<uint32_t>(segment.begin));
+            glBindVertexArray(segment.vao);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, segment.indirectBuffer);
+            glMultiDrawElementsIndirect(GL_POINTS, GL_UNSIGNED_INT, nullptr,
+                                        static_cast<GLsizei>(m_drawCommands.size()), 0);
+        }
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+
+    void SceneRenderer::configurePointAttributes() {
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(PointVertex), nullptr);
+
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(PointVertex),
+                              reinterpret_cast<const void*>(offsetof(PointVertex, color)));
+    }
 
+    void SceneRenderer::configureCompactPointAttributes() {
+        glEnableVertexAttribArray(0);
+        glVertexAttribIPointer(0, 2, GL_UNSIGNED_INT, sizeof(CompactPointVertex), nullptr);
+
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(CompactPointVertex),
+                              reinterpret_cast<const void*>(offsetof(CompactPointVertex, color)));
+    }
+
+    void SceneRenderer::beginPreview(const size_t capacity) {
+        endPreview();
+        if (capacity == 0) return;
+
+        glCreateVertexArrays(1, &m_previewVAO);
+        glCreateBuffers(1, &m_previewVBO);
+        glNamedBufferStorage(m_previewVBO, static_cast<GLsizeiptr>(capacity * sizeof(PointVertex)), nullptr,
+                             GL_DYNAMIC_STORAGE_BIT);
+
+        glBindVertexArray(m_previewVAO);
+        glBindBuffer(GL_ARRAY_BUFFER, m_previewVBO);
+        configurePointAttributes();
         glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        m_previewCapacity = capacity;
     }
 
-    void SceneRenderer::render(const std::vector<Point>& points, const SceneProperties* props,
-                               const EditorCamera* camera) const {
-        if (points.empty()) return;
+    void SceneRenderer::appendPreview(const std::vector<PointVertex>& points) {
+        if (!m_previewVBO) return;
 
-        glEnable(GL_BLEND);
-        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        const size_t count = std::min(points.size(), m_previewCapacity - m_previewCount);
+        if (count == 0) return;
+
+        glNamedBufferSubData(m_previewVBO, static_cast<GLintptr>(m_previewCount * sizeof(PointVertex)),
+                             static_cast<GLsizeiptr>(count * sizeof(PointVertex)), points.data());
+        m_previewCount += count;
+    }
+
+    void SceneRenderer::endPreview() {
+        if (m_previewVAO) {
+            glDeleteVertexArrays(1, &m_previewVAO);
+            m_previewVAO = 0;
+        }
+        if (m_previewVBO) {
+            glDeleteBuffers(1, &m_previewVBO);
+            m_previewVBO = 0;
+        }
+        m_previewCapacity = 0;
+        m_previewCount = 0;
+    }
+
+    void SceneRenderer::renderPreview(const SceneProperties* props, const EditorCamera* camera) const {
+        if (m_previewCount == 0) return;
 
         m_pointShader->bind();
         m_pointShader->setFloat("u_PointSize", props->pointSize);
         m_pointShader->setMat4("u_ViewProjection", camera->getViewProjection());
 
-        glBindVertexArray(m_VAO);
-        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(points.size()));
+        glBindVertexArray(m_previewVAO);
+        glVertexAttribI4ui(2, 0, 0, 0, 0);
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(m_previewCount));
 
         m_pointShader->unbind();
-        glDisable(GL_BLEND);
     }
 
-    void SceneRenderer::renderPickingPass(const std::vector<Point>& points, const SceneProperties* props,
-                                          const EditorCamera* camera) const {
+    void SceneRenderer::updateBuffers(const PointCloud& points, EditorSystem* editorSystem) {
+        if (points.empty() || m_segments.empty()) return;
+
+        SelectionManager* selection = editorSystem->getSelectionManager();
+        DirtyRanges& changed = selection->changedRanges;
+        DirtyRanges& moved = selection->movedRanges;
+        if (changed.empty() && moved.empty()) return;
+
+        changed.forEachRange(points.size(), [&](const size_t begin, const size_t count) {
+            uploadFlags(points, begin, count);
+            markLeavesDirty(begin, count);
+        });
+        size_t nextChunk = 0;
+        moved.forEachRange(points.size(), [&](const size_t begin, const size_t count) {
+            expandLeafBounds(points, begin, count);
+            if (!m_compact) {
+                uploadVertices(points, begin, count);
+                return;
+            }
+            // Moved points can leave their chunk's bounds, so the whole chunk is requantized once.
+            const size_t firstChunk = std::max(begin >> PointQuantizer::chunkShift, nextChunk);
+            const size_t endChunk = ((begin + count - 1) >> PointQuantizer::chunkShift) + 1;
+            if (firstChunk < endChunk) uploadCompactChunks(points, firstChunk, endChunk);
+            nextChunk = std::max(nextChunk, endChunk);
+        });
+        changed.clear();
+        moved.clear();
+
+        for (PointSegment& segment : m_segments) {
+            rebuildDirtyLeaves(points, segment);
+            segment.octree.refreshNodeBounds();
+        }
+        m_staging.submit();
+    }
+
+    void SceneRenderer::render(const PointCloud& points, const SceneProperties* props, const EditorCamera* camera) {
         if (points.empty()) return;
 
-        glDisable(GL_BLEND);
-        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
-        m_pickingShader->bind();
-        m_pickingShader->setFloat("u_PointSize", props->pointSize);
-        m_pickingShader->setMat4("u_ViewProjection", camera->getViewProjection());
+        const Shader* shader = m_compact ? m_compactPointShader.get() : m_pointShader.get();
+        shader->bind();
+        shader->setFloat("u_PointSize", props->pointSize);
+        shader->setMat4("u_ViewProjection", camera->getViewProjection());
+        if (m_compact) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_boundsSSBO);
 
-        glBindVertexArray(m_VAO);
-        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(points.size()));
+        drawVisiblePoints(*shader, props, camera, true);
 
-        m_pickingShader->unbind();
+        shader->unbind();
+        glDisable(GL_BLEND);
     }
 
-    int SceneRenderer::readPointID(const int mouseX, const int mouseY, const int vpHeight) {
-        const int glY = vpHeight - mouseY;
-
-        unsigned char pixel[4];
+    void SceneRenderer::renderPickingPass(const PointCloud& points, const SceneProperties* props,
+                                          const EditorCamera* camera) {
+        if (points.empty()) return;
 
-        glReadPixels(mouseX, glY, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixel);
+        glDisable(GL_BLEND);
+        glEnable(GL_DEPTH_TEST);
 
-        int id = pixel[0] | (pixel[1] << 8) | (pixel[2] << 16);
+        const Shader* shader = m_compact ? m_compactPickingShader.get() : m_pickingShader.get();
+        shader->bind();
+        shader->setFloat("u_PointSize", props->pointSize);
+        shader->setMat4("u_ViewProjection", camera->getViewProjection());
+        shader->setUInt("u_PickNode", 0);
+        if (m_compact) glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_boundsSSBO);
 
-        id -= 1;
+        drawVisiblePoints(*shader, props, camera, false);
 
-        return id;
+        shader->unbind();
     }
 
     void SceneRenderer::initPostProcess() {
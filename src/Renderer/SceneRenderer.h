@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include "Core/Frustum.hpp"
 #include "Core/Types.hpp"
+#include "PointOctree.h"
+#include "PointQuantizer.h"
 #include "Shader.h"
+#include "StagingRing.h"
 #include "EditorCamera.h"
 #include "Core/EditorSystem.h"
 
@@ -26,6 +30,23 @@
 
 
 namespace sfmeditor {
+    struct DrawElementsIndirectCommand {
+        uint32_t count;
+        uint32_t instanceCount;
+        uint32_t firstIndex;
+        int32_t baseVertex;
+        uint32_t baseInstance;
+    };
+
+    struct LodCandidate {
+        float priority;
+        uint32_t segment;
+        uint32_t node;
+        float parentFraction;
+
+        bool operator<(const LodCandidate& other) const { return priority < other.priority; }
+    };
+
     class SceneRenderer {
     public:
         SceneRenderer();
@@ -35,29 +56,80 @@ namespace sfmeditor {
         SceneRenderer(SceneRenderer&&) = default;
         SceneRenderer& operator=(SceneRenderer&&) = default;
 
-        void initBuffers(const std::vector<Point>& points);
+        void initBuffers(const PointCloud& points, bool compact);
+        bool usesCompactFormat() const { return m_compact; }
 
-        void updateBuffers(std::vector<Point>& points, EditorSystem* editorSystem);
+        void updateBuffers(const PointCloud& points, EditorSystem* editorSystem);
 
-        void render(const std::vector<Point>& points, const SceneProperties* props, const EditorCamera* camera) const;
+        void render(const PointCloud& points, const SceneProperties* props, const EditorCamera* camera);
 
-        void renderPickingPass(const std::vector<Point>& points, const SceneProperties* props,
-                               const EditorCamera* camera) const;
+        void renderPickingPass(const PointCloud& points, const SceneProperties* props, const EditorCamera* camera);
 
-        static int readPointID(int mouseX, int mouseY, int vpHeight);
+        void beginPreview(size_t capacity);
+        void appendPreview(const std::vector<PointVertex>& points);
+        void endPreview();
+        void renderPreview(const SceneProperties* props, const EditorCamera* camera) const;
 
         void initPostProcess();
         void renderPostProcess(uint32_t inputTexture, const EditorCamera* camera, const ViewportInfo& vp) const;
 
     private:
-        uint32_t m_VAO = 0, m_VBO = 0;
+        // Points are split into fixed-size segments with their own buffers so that no single buffer has to
+        // span the whole cloud. Each segment draws its octree leaves that survive culling. Point indices
+        // (selection, picking, tracks) stay 32-bit, so a cloud is limited to 2^32 - 1 points.
+        struct PointSegment {
+            size_t begin = 0;
+            size_t count = 0;
+            uint32_t vao = 0, vbo = 0, flagsVbo = 0, indexBuffer = 0, indirectBuffer = 0;
+            PointOctree octree;
+            std::vector<uint32_t> leafVisibleCounts;
+            std::vector<uint64_t> visiblePrefix;
+            std::vector<uint8_t> dirtyLeaves;
+            bool hasDirtyLeaves = false;
+            std::vector<float> nodeFractions;
+        };
+
+        static constexpr uint32_t segmentShift = 26;
+        static constexpr size_t segmentSize = size_t(1) << segmentShift;
+        static constexpr size_t stagingRegionBytes = size_t(4) << 20;
+
+        void releasePointBuffers();
+        // Fills at most `bytes` through the staging ring and copies the size returned by `fill` into `buffer`.
+        // If the ring has no mapping, the data goes through a CPU scratch buffer and glNamedBufferSubData.
+        template <typename Fill>
+        void stageUpload(uint32_t buffer, size_t dstOffset, size_t bytes, Fill&& fill);
+        static void configurePointAttributes();
+        static void configureCompactPointAttributes();
+        void uploadVertices(const PointCloud& points, size_t begin, size_t count);
+        void uploadCompactChunks(const PointCloud& points, size_t firstChunk, size_t endChunk);
+        void uploadFlags(const PointCloud& points, size_t begin, size_t count);
+        void markLeavesDirty(size_t begin, size_t count);
+        void expandLeafBounds(const PointCloud& points, size_t begin, size_t count);
+        void rebuildDirtyLeaves(const PointCloud& points, PointSegment& segment);
+        void selectLevelOfDetail(const Frustum& frustum, const glm::vec3& eye, size_t budget);
+        // The picking pass skips the point budget so that every visible point stays selectable.
+        void drawVisiblePoints(const Shader& shader, const SceneProperties* props, const EditorCamera* camera,
+                               bool applyBudget);
+
+        std::vector<PointSegment> m_segments;
+        bool m_compact = false;
+        uint32_t m_boundsSSBO = 0;
+        std::vector<ChunkBounds> m_chunkBounds;
+        std::vector<DrawElementsIndirectCommand> m_drawCommands;
+        std::vector<LodCandidate> m_lodQueue;
+        StagingRing m_staging;
+        std::vector<uint8_t> m_uploadScratch;
+
+        uint32_t m_previewVAO = 0, m_previewVBO = 0;
+        size_t m_previewCapacity = 0;
+        size_t m_previewCount = 0;
 
         std::unique_ptr<Shader> m_pointShader;
         std::unique_ptr<Shader> m_pickingShader;
+        std::unique_ptr<Shader> m_compactPointShader;
+        std::unique_ptr<Shader> m_compactPickingShader;
         std::unique_ptr<Shader> m_postProcessShader;
 
-        const float m_thresholdFactor = 0.1f;
-
         uint32_t m_ppVAO = 0, m_ppVBO = 0;
     };
 }
@@ -73,6 +73,10 @@ namespace sfmeditor {
         glUniform1i(glGetUniformLocation(m_rendererID, name.c_str()), value);
     }
 
+    void Shader::setUInt(const std::string& name, uint32_t value) const {
+        glUniform1ui(glGetUniformLocation(m_rendererID, name.c_str()), value);
+    }
+
     void Shader::setFloat(const std::string& name, float value) const {
         glUniform1f(glGetUniformLocation(m_rendererID, name.c_str()), value);
     }
@@ -34,6 +34,7 @@ namespace sfmeditor {
 
         void setBool(const std::string& name, bool value) const;
         void setInt(const std::string& name, int value) const;
+        void setUInt(const std::string& name, uint32_t value) const;
         void setFloat(const std::string& name, float value) const;
         void setFloatArray(const std::string& name, const float* values, uint32_t count) const;
 
@@ -0,0 +1,102 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "StagingRing.h"
+
+#include "Core/Logger.h"
+
+#include <glad/glad.h>
+
+
+namespace sfmeditor {
+    StagingRing::~StagingRing() {
+        release();
+    }
+
+    void StagingRing::init(const size_t regionBytes) {
+        release();
+
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        const auto totalBytes = static_cast<GLsizeiptr>(regionBytes * regionCount);
+
+        glCreateBuffers(1, &m_buffer);
+        glNamedBufferStorage(m_buffer, totalBytes, nullptr, flags);
+        m_mapped = static_cast<uint8_t*>(glMapNamedBufferRange(m_buffer, 0, totalBytes, flags));
+
+        if (!m_mapped) {
+            Logger::error("Failed to map the staging buffer.");
+            release();
+            return;
+        }
+        m_regionBytes = regionBytes;
+    }
+
+    void StagingRing::release() {
+        for (void*& fence : m_fences) {
+            if (fence) glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+        if (m_buffer) {
+            if (m_mapped) glUnmapNamedBuffer(m_buffer);
+            glDeleteBuffers(1, &m_buffer);
+        }
+        m_buffer = 0;
+        m_mapped = nullptr;
+        m_regionBytes = 0;
+        m_head = 0;
+        m_region = 0;
+    }
+
+    void* StagingRing::allocate(const size_t bytes, size_t& outOffset) {
+        if (!m_mapped || bytes > m_regionBytes) return nullptr;
+
+        m_head = (m_head + 15) & ~size_t(15);
+        if (m_head + bytes > m_regionBytes) submit();
+
+        outOffset = m_region * m_regionBytes + m_head;
+        m_head += bytes;
+        return m_mapped + outOffset;
+    }
+
+    void StagingRing::copyTo(const uint32_t dstBuffer, const size_t srcOffset, const size_t dstOffset,
+                             const size_t bytes) const {
+        glCopyNamedBufferSubData(m_buffer, dstBuffer, static_cast<GLintptr>(srcOffset),
+                                 static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(bytes));
+    }
+
+    void StagingRing::submit() {
+        if (m_head == 0) return;
+
+        m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_region = (m_region + 1) % regionCount;
+        m_head = 0;
+        waitForRegion(m_region);
+    }
+
+    void StagingRing::waitForRegion(const uint32_t region) {
+        void*& fence = m_fences[region];
+        if (!fence) return;
+
+        const auto sync = static_cast<GLsync>(fence);
+        GLenum result = glClientWaitSync(sync, 0, 0);
+        while (result == GL_TIMEOUT_EXPIRED) {
+            result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000);
+        }
+        glDeleteSync(sync);
+        fence = nullptr;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace sfmeditor {
+    // Persistently mapped upload buffer split into fenced regions. The CPU writes into one region while the GPU
+    // copies out of the others; a region is only reused after the fence placed at its submission has signalled.
+    class StagingRing {
+    public:
+        static constexpr uint32_t regionCount = 3;
+
+        StagingRing() = default;
+        ~StagingRing();
+        StagingRing(const StagingRing&) = delete;
+        StagingRing& operator=(const StagingRing&) = delete;
+
+        void init(size_t regionBytes);
+        void release();
+
+        size_t capacity() const { return m_regionBytes; }
+
+        void* allocate(size_t bytes, size_t& outOffset);
+        void copyTo(uint32_t dstBuffer, size_t srcOffset, size_t dstOffset, size_t bytes) const;
+        void submit();
+
+    private:
+        void waitForRegion(uint32_t region);
+
+        uint32_t m_buffer = 0;
+        uint8_t* m_mapped = nullptr;
+        size_t m_regionBytes = 0;
+        size_t m_head = 0;
+        uint32_t m_region = 0;
+        std::array<void*, regionCount> m_fences{};
+    };
+}
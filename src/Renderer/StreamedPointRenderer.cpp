@@ -0,0 +1,215 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "StreamedPointRenderer.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <limits>
+#include <ranges>
+
+
+namespace sfmeditor {
+    StreamedPointRenderer::StreamedPointRenderer() {
+        m_pointShader = std::make_unique<Shader>("assets/shaders/basic.vert", "assets/shaders/basic.frag");
+        m_pickingShader = std::make_unique<Shader>("assets/shaders/picking.vert", "assets/shaders/picking.frag");
+    }
+
+    StreamedPointRenderer::~StreamedPointRenderer() {
+        reset();
+    }
+
+    void StreamedPointRenderer::reset() {
+        for (auto& [node, gpuNode] : m_gpuNodes) releaseNode(gpuNode);
+        m_gpuNodes.clear();
+        m_order.clear();
+        m_drawList.clear();
+        m_gpuBytes = 0;
+    }
+
+    void StreamedPointRenderer::releaseNode(GpuNode& gpuNode) {
+        glDeleteVertexArrays(1, &gpuNode.vao);
+        const uint32_t buffers[] = {gpuNode.vbo, gpuNode.flagsVbo};
+        glDeleteBuffers(2, buffers);
+    }
+
+    void StreamedPointRenderer::selectNodes(PointStreamer& streamer, const Frustum& frustum, const glm::vec3& eye,
+                                            const size_t budget) {
+        auto projectedSize = [&](const StoredNode& node) {
+            const float radius = glm::length(node.max - node.min) * 0.5f;
+            const float distance = glm::length((node.min + node.max) * 0.5f - eye);
+            return distance > radius ? radius / distance : std::numeric_limits<float>::max();
+        };
+
+        const std::vector<StoredNode>& nodes = streamer.nodes();
+        m_queue.clear();
+        m_drawList.clear();
+        if (nodes.empty() || !frustum.intersects(nodes[0].min, nodes[0].max)) return;
+        m_queue.push_back({projectedSize(nodes[0]), 0});
+
+        // Requested nodes count against both budgets too, so the working set never outgrows host memory.
+        size_t remainingPoints = budget;
+        size_t remainingBytes = streamer.hostBudget();
+        while (!m_queue.empty()) {
+            std::pop_heap(m_queue.begin(), m_queue.end());
+            const NodeCandidate candidate = m_queue.back();
+            m_queue.pop_back();
+
+            const StoredNode& node = nodes[candidate.node];
+            const size_t bytes = PointNodeStore::payloadBytes(node.pointCount);
+            if (node.pointCount > remainingPoints || bytes > remainingBytes) continue;
+            remainingPoints -= node.pointCount;
+            remainingBytes -= bytes;
+
+            const PointCloud* points = streamer.acquire(candidate.node);
+            if (!points) {
+                streamer.request(candidate.node, candidate.priority);
+                continue;
+            }
+            m_drawList.emplace_back(candidate.node, points);
+
+            for (uint32_t child = node.firstChild; child < node.firstChild + node.childCount; ++child) {
+                if (!frustum.intersects(nodes[child].min, nodes[child].max)) continue;
+                m_queue.push_back({projectedSize(nodes[child]), child});
+                std::push_heap(m_queue.begin(), m_queue.end());
+            }
+        }
+    }
+
+    StreamedPointRenderer::GpuNode& StreamedPointRenderer::uploadNode(const uint32_t node, const PointCloud& points,
+                                                                      const uint32_t revision) {
+        GpuNode& gpuNode = m_gpuNodes[node];
+        gpuNode.count = static_cast<uint32_t>(points.size());
+        gpuNode.revision = revision;
+        gpuNode.bytes = points.size() * (sizeof(PointVertex) + sizeof(uint8_t));
+
+        m_packed.resize(points.size());
+        points.packVertices(0, points.size(), m_packed.data());
+
+        glCreateVertexArrays(1, &gpuNode.vao);
+        glCreateBuffers(1, &gpuNode.vbo);
+        glCreateBuffers(1, &gpuNode.flagsVbo);
+        glNamedBufferStorage(gpuNode.vbo, static_cast<GLsizeiptr>(m_packed.size() * sizeof(PointVertex)),
+                             m_packed.data(), 0);
+        glNamedBufferStorage(gpuNode.flagsVbo, static_cast<GLsizeiptr>(points.size()), points.flags.data(),
+                             GL_DYNAMIC_STORAGE_BIT);
+
+        glBindVertexArray(gpuNode.vao);
+        glBindBuffer(GL_ARRAY_BUFFER, gpuNode.vbo);
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(PointVertex), nullptr);
+        glEnableVertexAttribArray(1);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(PointVertex),
+                              reinterpret_cast<const void*>(offsetof(PointVertex, color)));
+
+        glBindBuffer(GL_ARRAY_BUFFER, gpuNode.flagsVbo);
+        glEnableVertexAttribArray(2);
+        glVertexAttribIPointer(2, 1, GL_UNSIGNED_BYTE, sizeof(uint8_t), nullptr);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        glBindVertexArray(0);
+
+        m_order.push_front(node);
+        gpuNode.order = m_order.begin();
+        m_gpuBytes += gpuNode.bytes;
+        return gpuNode;
+    }
+
+    void StreamedPointRenderer::evictOverBudget(const size_t budgetBytes) {
+        auto it = m_order.end();
+        while (m_gpuBytes > budgetBytes && it != m_order.begin()) {
+            --it;
+            const auto gpuNode = m_gpuNodes.find(*it);
+            if (gpuNode->second.lastUsedFrame == m_frame) break;
+
+            m_gpuBytes -= gpuNode->second.bytes;
+            releaseNode(gpuNode->second);
+            m_gpuNodes.erase(gpuNode);
+            it = m_order.erase(it);
+        }
+    }
+
+    void StreamedPointRenderer::render(PointStreamer& streamer, const SceneProperties* props,
+                                       const EditorCamera* camera) {
+        ++m_frame;
+
+        const Frustum frustum(camera->getViewProjection());
+        const size_t budget = props->limitPointBudget && props->pointBudget > 0
+                                  ? static_cast<size_t>(props->pointBudget)
+                                  : std::numeric_limits<size_t>::max();
+        selectNodes(streamer, frustum, camera->position, budget);
+
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+        m_pointShader->bind();
+        m_pointShader->setFloat("u_PointSize", props->pointSize);
+        m_pointShader->setMat4("u_ViewProjection", camera->getViewProjection());
+
+        // Uploads are capped per frame so a sudden view change cannot stall the frame; later nodes wait a frame.
+        size_t uploadedBytes = 0;
+        for (const auto& [node, points] : m_drawList) {
+            const uint32_t revision = streamer.revision(node);
+            auto it = m_gpuNodes.find(node);
+            GpuNode* gpuNode = it != m_gpuNodes.end() ? &it->second : nullptr;
+
+            if (!gpuNode) {
+                if (uploadedBytes >= maxUploadBytesPerFrame) continue;
+                gpuNode = &uploadNode(node, *points, revision);
+                uploadedBytes += gpuNode->bytes;
+            } else if (gpuNode->revision != revision) {
+                glNamedBufferSubData(gpuNode->flagsVbo, 0, static_cast<GLsizeiptr>(points->size()),
+                                     points->flags.data());
+                gpuNode->revision = revision;
+            }
+
+            m_order.splice(m_order.begin(), m_order, gpuNode->order);
+            gpuNode->lastUsedFrame = m_frame;
+
+            glBindVertexArray(gpuNode->vao);
+            glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(gpuNode->count));
+        }
+        glBindVertexArray(0);
+
+        m_pointShader->unbind();
+        glDisable(GL_BLEND);
+
+        evictOverBudget(static_cast<size_t>(std::max(props->streamingGpuBudgetMB, 0)) << 20);
+    }
+
+    void StreamedPointRenderer::renderPickingPass(const SceneProperties* props, const EditorCamera* camera) {
+        glDisable(GL_BLEND);
+        glEnable(GL_DEPTH_TEST);
+
+        m_pickingShader->bind();
+        m_pickingShader->setFloat("u_PointSize", props->pointSize);
+        m_pickingShader->setMat4("u_ViewProjection", camera->getViewProjection());
+        m_pickingShader->setUInt("u_BaseIndex", 0);
+
+        // Only the node ids of the draw list are used; its point pointers may have been evicted since.
+        for (const uint32_t node : m_drawList | std::views::keys) {
+            const auto it = m_gpuNodes.find(node);
+            if (it == m_gpuNodes.end()) continue;
+
+            m_pickingShader->setUInt("u_PickNode", node + 1);
+            glBindVertexArray(it->second.vao);
+            glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(it->second.count));
+        }
+        glBindVertexArray(0);
+
+        m_pickingShader->unbind();
+    }
+}
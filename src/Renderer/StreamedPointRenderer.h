@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 Yağız Cem Kocabıyık
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+#include "Core/Frustum.hpp"
+#include "Core/Types.hpp"
+#include "IO/PointStreamer.h"
+#include "Shader.h"
+#include "EditorCamera.h"
+
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+
+namespace sfmeditor {
+    // Draws a streamed cloud. Store nodes are refined coarse-to-fine by projected size within the point budget;
+    // nodes that are not in memory yet are requested from the streamer and their parents stand in meanwhile.
+    class StreamedPointRenderer {
+    public:
+        StreamedPointRenderer();
+        ~StreamedPointRenderer();
+        StreamedPointRenderer(const StreamedPointRenderer&) = delete;
+        StreamedPointRenderer& operator=(const StreamedPointRenderer&) = delete;
+
+        void reset();
+        void render(PointStreamer& streamer, const SceneProperties* props, const EditorCamera* camera);
+        // Picks among the nodes drawn last frame, writing node + 1 next to each point index.
+        void renderPickingPass(const SceneProperties* props, const EditorCamera* camera);
+
+        size_t gpuBytes() const { return m_gpuBytes; }
+        size_t gpuNodeCount() const { return m_gpuNodes.size(); }
+
+    private:
+        struct GpuNode {
+            uint32_t vao = 0, vbo = 0, flagsVbo = 0;
+            uint32_t count = 0;
+            uint32_t revision = 0;
+            size_t bytes = 0;
+            uint64_t lastUsedFrame = 0;
+            std::list<uint32_t>::iterator order;
+        };
+
+        struct NodeCandidate {
+            float priority;
+            uint32_t node;
+
+            bool operator<(const NodeCandidate& other) const { return priority < other.priority; }
+        };
+
+        static constexpr size_t maxUploadBytesPerFrame = 64 << 20;
+
+        void selectNodes(PointStreamer& streamer, const Frustum& frustum, const glm::vec3& eye, size_t budget);
+        GpuNode& uploadNode(uint32_t node, const PointCloud& points, uint32_t revision);
+        void evictOverBudget(size_t budgetBytes);
+        static void releaseNode(GpuNode& gpuNode);
+
+        std::unique_ptr<Shader> m_pointShader;
+        std::unique_ptr<Shader> m_pickingShader;
+        std::unordered_map<uint32_t, GpuNode> m_gpuNodes;
+        std::list<uint32_t> m_order;
+        std::vector<NodeCandidate> m_queue;
+        std::vector<std::pair<uint32_t, const PointCloud*>> m_drawList;
+        std::vector<PointVertex> m_packed;
+        size_t m_gpuBytes = 0;
+        uint64_t m_frame = 0;
+    };
+}
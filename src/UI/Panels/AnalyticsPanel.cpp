@@ -19,7 +19,6 @@
 #include <imgui.h>
 #include <algorithm>
 #include <format>
-#include <unordered_set>
 
 
 namespace sfmeditor {
@@ -76,15 +75,16 @@ namespace sfmeditor {
         size_t validPoints = 0;
 
         for (size_t i = 0; i < m_scene->points.size(); ++i) {
-            if (m_scene->points[i].selected < -0.5f || i >= m_scene->metadata.size()) continue;
+            if (m_scene->points.isDeleted(i) || i >= m_scene->metadata.size()) continue;
 
             const auto& meta = m_scene->metadata[i];
+            const size_t trackLength = i < m_scene->tracks.size() ? m_scene->tracks.trackLength(i) : 0;
 
             if (meta.error > m_maxError) m_maxError = static_cast<float>(meta.error);
             m_avgError += static_cast<float>(meta.error);
 
-            m_maxTrackLength = std::max(meta.observations.size(), m_maxTrackLength);
-            m_avgTrackLength += static_cast<float>(meta.observations.size());
+            m_maxTrackLength = std::max(trackLength, m_maxTrackLength);
+            m_avgTrackLength += static_cast<float>(trackLength);
 
             validPoints++;
         }
@@ -97,21 +97,22 @@ namespace sfmeditor {
             const int trackBinCount = static_cast<int>(m_trackHistogram.size());
 
             for (size_t i = 0; i < m_scene->points.size(); ++i) {
-                if (m_scene->points[i].selected < -0.5f || i >= m_scene->metadata.size()) continue;
+                if (m_scene->points.isDeleted(i) || i >= m_scene->metadata.size()) continue;
 
                 const auto& meta = m_scene->metadata[i];
 
                 int errorBin = static_cast<int>((meta.error / m_maxError) * (errorBinCount - 1));
                 m_errorHistogram[std::clamp(errorBin, 0, errorBinCount - 1)] += 1.0f;
 
-                int trackBin = static_cast<int>(meta.observations.size());
+                const size_t trackLength = i < m_scene->tracks.size() ? m_scene->tracks.trackLength(i) : 0;
+                int trackBin = static_cast<int>(trackLength);
                 m_trackHistogram[std::clamp(trackBin, 0, trackBinCount - 1)] += 1.0f;
             }
         }
 
         m_imageStats.reserve(m_scene->images.size());
-        for (const auto& [id, img] : m_scene->images) {
-            m_imageStats.push_back({id, img.imageName, img.cameraID, img.features.size()});
+        for (const CameraPose& img : m_scene->images) {
+            m_imageStats.push_back({img.imageID, img.nameId, img.cameraID, m_scene->features.count(img.imageID)});
         }
 
         m_needsRefresh = false;
@@ -201,7 +202,7 @@ namespace sfmeditor {
                                   switch (spec.ColumnUserID) {
                                   case 0: res = a.imageID < b.imageID;
                                       break;
-                                  case 1: res = a.name < b.name;
+                                  case 1: res = m_scene->imageNames.get(a.nameId) < m_scene->imageNames.get(b.nameId);
                                       break;
                                   case 2: res = a.cameraID < b.cameraID;
                                       break;
@@ -214,8 +215,7 @@ namespace sfmeditor {
                 }
             }
 
-            const auto& selectedVec = m_editorSystem->getSelectionManager()->selectedImageIDs;
-            std::unordered_set<uint32_t> selectedSet(selectedVec.begin(), selectedVec.end());
+            const SelectionSet& selectedSet = m_editorSystem->getSelectionManager()->selectedImageIDs;
 
             for (const auto& stat : m_imageStats) {
                 ImGui::TableNextRow();
@@ -238,7 +238,8 @@ namespace sfmeditor {
                 }
 
                 ImGui::TableSetColumnIndex(1);
-                ImGui::TextUnformatted(stat.name.c_str());
+                const std::string_view name = m_scene->imageNames.get(stat.nameId);
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
 
                 ImGui::TableSetColumnIndex(2);
                 ImGui::Text("%u", stat.cameraID);
@@ -26,7 +26,7 @@
 namespace sfmeditor {
     struct ImageStatData {
         uint32_t imageID;
-        std::string name;
+        uint32_t nameId;
         uint32_t cameraID;
         size_t featureCount;
     };
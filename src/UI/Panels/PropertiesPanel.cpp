@@ -17,6 +17,7 @@
 #include "PropertiesPanel.h"
 
 #include "Core/Logger.h"
+#include "IO/PointStreamer.h"
 
 #include <algorithm>
 #include <imgui.h>
@@ -91,24 +92,24 @@ namespace sfmeditor {
         auto drawFeatures = [&](ImDrawList* dl, const ImVec2 startPos, const float width, const float height,
                                 const float baseSize) {
             if (image_id == 0 || !m_scene->images.contains(image_id)) return;
-            const auto& imgPose = m_scene->images.at(image_id);
+            const FeatureView features = m_scene->features.get(image_id);
 
             if (point2D_idx != -1) {
-                if (point2D_idx < imgPose.features.size()) {
-                    const glm::vec2 rawCoord = imgPose.features[point2D_idx].coordinates;
+                if (point2D_idx < features.size()) {
+                    const glm::vec2 rawCoord = features.coordinates[point2D_idx];
                     const float normX = rawCoord.x / static_cast<float>(tex.width);
                     const float normY = rawCoord.y / static_cast<float>(tex.height);
                     const ImVec2 center(startPos.x + normX * width, startPos.y + normY * height);
                     dl->AddCircle(center, baseSize * 2.0f, IM_COL32(255, 50, 50, 255), 0, 2.0f);
                 }
             } else {
-                for (const auto& feat : imgPose.features) {
-                    if (feat.point3D_id == static_cast<uint64_t>(-1)) {
+                for (size_t i = 0; i < features.size(); ++i) {
+                    if (features.pointIndices[i] == FeatureStore::noPoint) {
                         continue;
                     }
 
-                    const float normX = feat.coordinates.x / static_cast<float>(tex.width);
-                    const float normY = feat.coordinates.y / static_cast<float>(tex.height);
+                    const float normX = features.coordinates[i].x / static_cast<float>(tex.width);
+                    const float normY = features.coordinates[i].y / static_cast<float>(tex.height);
                     const ImVec2 center(startPos.x + normX * width, startPos.y + normY * height);
 
                     dl->AddCircle(center, baseSize * 2.0f, IM_COL32(0, 255, 100, 150), 0, 2.0f);
@@ -153,10 +154,16 @@ namespace sfmeditor {
     void PropertiesPanel::onRender() {
         ImGui::Begin("Properties");
         if (ImGui::CollapsingHeader("Statistics", ImGuiTreeNodeFlags_DefaultOpen)) {
-            const size_t visiblePointCount = std::count_if(m_scene->points.begin(), m_scene->points.end(),
-                                                           [](const auto& p) { return p.selected > -0.5f; });
+            const size_t visiblePointCount = std::count_if(m_scene->points.flags.begin(), m_scene->points.flags.end(),
+                                                           [](const uint8_t f) { return !(f & PointDeleted); });
             ImGui::Text("Total Points: %zu", visiblePointCount);
             ImGui::Text("Total Cameras: %zu", m_scene->cameras.size());
+            if (const PointStreamer* streamer = m_scene->streamedPoints.get()) {
+                ImGui::Text("Streamed Points: %llu", static_cast<unsigned long long>(streamer->pointCount()));
+                ImGui::Text("Resident Nodes: %zu (%.1f MB, %zu loading)", streamer->residentCount(),
+                            static_cast<double>(streamer->residentBytes()) / (1024.0 * 1024.0),
+                            streamer->pendingCount());
+            }
             const ImGuiIO& io = ImGui::GetIO();
             ImGui::Text("FPS: %.1f", io.Framerate);
             ImGui::Text("Frame Time: %.3f ms", io.DeltaTime * 1000.0f);
@@ -169,8 +176,8 @@ namespace sfmeditor {
 
             m_camera->teleportTo(imgPose.position, worldRot);
 
-            if (m_scene->cameras.contains(imgPose.cameraID)) {
-                const auto& camLens = m_scene->cameras.at(imgPose.cameraID);
+            if (const Camera* lens = m_scene->cameras.find(imgPose.cameraID)) {
+                const Camera& camLens = *lens;
 
                 if (camLens.height > 0 && camLens.focalLengthY > 0.0f) {
                     const float fovY_rad = 2.0f * std::atan(
@@ -202,56 +209,40 @@ namespace sfmeditor {
             m_camera->projectionMode = ProjectionMode::Perspective;
             m_camera->updateProjection();
 
-            Logger::info("Teleported to image " + imgPose.imageName);
+            Logger::info("Teleported to image " + std::string(m_scene->imageNames.get(imgPose.nameId)));
         };
 
         static bool isIsolating = false;
-        static std::vector<float> originalSelectionStates;
 
         auto isolateImageFeatures = [&](const uint32_t camID, const bool isButtonActive) {
+            PointCloud& points = m_scene->points;
             if (isButtonActive && !isIsolating) {
                 isIsolating = true;
 
                 m_editorSystem->isolatedImageID = camID;
 
-                originalSelectionStates.resize(m_scene->points.size());
-
-                for (size_t i = 0; i < m_scene->points.size(); ++i) {
-                    originalSelectionStates[i] = m_scene->points[i].selected;
-                    m_scene->points[i].selected = -1.0f;
-                    m_editorSystem->getSelectionManager()->markAsChanged(static_cast<unsigned int>(i));
+                for (size_t i = 0; i < points.size(); ++i) {
+                    points.setFlag(i, PointHidden, true);
                 }
+                m_editorSystem->getSelectionManager()->markAllChanged();
 
-                for (size_t i = 0; i < m_scene->metadata.size() && i < m_scene->points.size(); ++i) {
-                    const auto& meta = m_scene->metadata[i];
-                    bool seenByCamera = false;
-                    for (const auto& obs : meta.observations) {
+                for (size_t i = 0; i < m_scene->tracks.size() && i < points.size(); ++i) {
+                    for (const auto& obs : m_scene->tracks[i]) {
                         if (obs.image_id == camID) {
-                            seenByCamera = true;
+                            points.flags[i] = (points.flags[i] & ~PointHidden) | PointIsolated;
                             break;
                         }
                     }
-
-                    if (seenByCamera) {
-                        if (originalSelectionStates[i] > 0.5f) {
-                            m_scene->points[i].selected = 1.0f;
-                        } else if (originalSelectionStates[i] >= 0.0f && originalSelectionStates[i] <= 0.5f) {
-                            m_scene->points[i].selected = 0.0f;
-                        }
-
-                        m_editorSystem->getSelectionManager()->markAsChanged(static_cast<unsigned int>(i));
-                    }
                 }
             } else if (!isButtonActive && isIsolating) {
                 isIsolating = false;
 
                 m_editorSystem->isolatedImageID = 0;
 
-                for (size_t i = 0; i < m_scene->points.size(); ++i) {
-                    m_scene->points[i].selected = originalSelectionStates[i];
-                    m_editorSystem->getSelectionManager()->markAsChanged(static_cast<unsigned int>(i));
+                for (size_t i = 0; i < points.size(); ++i) {
+                    points.flags[i] &= ~(PointHidden | PointIsolated);
                 }
-                originalSelectionStates.clear();
+                m_editorSystem->getSelectionManager()->markAllChanged();
             }
         };
 
@@ -264,7 +255,7 @@ namespace sfmeditor {
                 ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "Multiple points selected (%zu)",
                                    selectedIndices.size());
             } else {
-                unsigned int pointIdx = selectedIndices[0];
+                unsigned int pointIdx = selectedIndices.front();
 
                 if (pointIdx < m_scene->metadata.size()) {
                     const auto& meta = m_scene->metadata[pointIdx];
@@ -272,21 +263,24 @@ namespace sfmeditor {
                     ImGui::Text("ID: %llu", meta.original_id);
                     ImGui::Text("Reproj. Error: %.4f px", meta.error);
                     ImGui::Separator();
-                    ImGui::Text("Observed in %zu Images:", meta.observations.size());
+                    const std::span<const PointObservation> track = pointIdx < m_scene->tracks.size()
+                                                                        ? m_scene->tracks[pointIdx]
+                                                                        : std::span<const PointObservation>();
+                    ImGui::Text("Observed in %zu Images:", track.size());
 
                     ImGui::BeginChild("TrackList", ImVec2(0, 300), true);
 
-                    for (const auto& obs : meta.observations) {
-                        std::string imgName = "Unknown";
-                        if (m_scene->images.contains(obs.image_id)) {
-                            imgName = m_scene->images.at(obs.image_id).imageName;
-                        }
+                    for (const auto& obs : track) {
+                        const CameraPose* obsImage = m_scene->images.find(obs.image_id);
+                        const std::string imgName = obsImage
+                                                        ? std::string(m_scene->imageNames.get(obsImage->nameId))
+                                                        : "Unknown";
 
                         if (ImGui::TreeNode((void*)static_cast<intptr_t>(obs.image_id), "%s (Feature: %d)",
                                             imgName.c_str(), obs.point2D_idx)) {
-                            if (m_scene->images.contains(obs.image_id)) {
+                            if (obsImage) {
                                 if (ImGui::Button("Teleport Here", ImVec2(ImGui::GetContentRegionAvail().x, 0.0f))) {
-                                    teleportCamera(m_scene->images.at(obs.image_id));
+                                    teleportCamera(*obsImage);
                                 }
 
                                 ImGui::Button("Hold to Isolate Features",
@@ -315,16 +309,17 @@ namespace sfmeditor {
             } else if (selCams.size() > 1) {
                 ImGui::TextColored(ImVec4(1.0f, 0.8f, 0.2f, 1.0f), "Multiple images selected (%zu)", selCams.size());
             } else {
-                uint32_t imageID = selCams[0];
-                if (m_scene->images.contains(imageID)) {
-                    const auto& img = m_scene->images.at(imageID);
+                uint32_t imageID = selCams.front();
+                if (const CameraPose* selected = m_scene->images.find(imageID)) {
+                    const CameraPose& img = *selected;
+                    const std::string imageName(m_scene->imageNames.get(img.nameId));
 
-                    ImGui::TextColored(ImVec4(0.4f, 1.0f, 0.4f, 1.0f), "Image: %s", img.imageName.c_str());
+                    ImGui::TextColored(ImVec4(0.4f, 1.0f, 0.4f, 1.0f), "Image: %s", imageName.c_str());
                     ImGui::Text("Image ID: %u", img.imageID);
                     ImGui::Text("Sensor / Camera ID: %u", img.cameraID);
 
-                    if (m_scene->cameras.contains(img.cameraID)) {
-                        auto& cam = m_scene->cameras.at(img.cameraID);
+                    if (const Camera* lens = m_scene->cameras.find(img.cameraID)) {
+                        const Camera& cam = *lens;
 
                         const char* modelNames[] = {
                             "SIMPLE_PINHOLE", "PINHOLE", "SIMPLE_RADIAL", "RADIAL", "OPENCV", "OPENCV_FISHEYE",
@@ -367,13 +362,14 @@ namespace sfmeditor {
                     }
 
                     ImGui::Separator();
-                    const size_t numTriangulated = std::count_if(
-                        img.features.begin(),
-                        img.features.end(),
-                        [](const auto& f) { return f.point3D_id != -1; }
+                    const FeatureView features = m_scene->features.get(imageID);
+                    const size_t numTriangulated = features.size() - std::count(
+                        features.pointIndices.begin(),
+                        features.pointIndices.end(),
+                        FeatureStore::noPoint
                     );
                     ImGui::Text("Features: %zu points (%zu triangulated)",
-                                img.features.size(),
+                                features.size(),
                                 numTriangulated);
 
                     ImGui::Dummy(ImVec2(0.0f, 2.0f));
@@ -386,9 +382,9 @@ namespace sfmeditor {
 
                     ImGui::Dummy(ImVec2(0.0f, 2.0f));
 
-                    const std::string fullPath = m_scene->imageBasePath + "\\" + img.imageName;
+                    const std::string fullPath = m_scene->imageBasePath + "\\" + imageName;
                     const UITexture tex = getOrLoadImage(fullPath);
-                    renderImageWithTooltip(tex, img.imageName, imageID);
+                    renderImageWithTooltip(tex, imageName, imageID);
                 }
             }
         }
@@ -401,6 +397,22 @@ namespace sfmeditor {
             ImGui::Checkbox("Show Cameras", &m_sceneProperties->showCameras);
             ImGui::DragFloat("Point Size", &m_sceneProperties->pointSize, 0.1f, 0.1f, 100.0f);
             ImGui::DragFloat("Camera Size", &m_sceneProperties->cameraSize, 0.1f, 0.1f, 100.0f);
+            ImGui::Checkbox("Compact GPU Point Format", &m_sceneProperties->compactPointFormat);
+            ImGui::Checkbox("Limit Point Budget", &m_sceneProperties->limitPointBudget);
+            if (m_sceneProperties->limitPointBudget) {
+                ImGui::DragInt("Point Budget", &m_sceneProperties->pointBudget, 100000.0f, 100000, 1000000000);
+            }
+        }
+
+        if (ImGui::CollapsingHeader("Load Settings")) {
+            ImGui::Checkbox("Use Scene Cache (.sfmc)", &m_sceneProperties->useSceneCache);
+            ImGui::Checkbox("Load Image Features On Demand", &m_sceneProperties->lazyFeatures);
+            ImGui::Checkbox("Reorder Points Spatially (Morton)", &m_sceneProperties->spatialPointOrder);
+            ImGui::Checkbox("Stream Points Out-of-Core (.sfmn)", &m_sceneProperties->outOfCorePoints);
+            if (m_sceneProperties->outOfCorePoints) {
+                ImGui::DragInt("Host Budget (MB)", &m_sceneProperties->streamingHostBudgetMB, 16.0f, 256, 262144);
+                ImGui::DragInt("GPU Budget (MB)", &m_sceneProperties->streamingGpuBudgetMB, 16.0f, 128, 65536);
+            }
         }
 
         if (ImGui::CollapsingHeader("Transform Settings", ImGuiTreeNodeFlags_DefaultOpen)) {
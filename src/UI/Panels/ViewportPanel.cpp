@@ -60,7 +60,8 @@ namespace sfmeditor {
             }
         }
 
-        if (m_editorSystem->getSelectionManager()->hasSelection() && m_editorSystem->gizmoOperation != -1) {
+        if (m_editorSystem->getSelectionManager()->hasTransformableSelection() &&
+            m_editorSystem->gizmoOperation != -1) {
             ImGuizmo::SetOrthographic(m_camera->projectionMode == ProjectionMode::Orthographic);
             ImGuizmo::SetDrawlist();
             ImGuizmo::SetRect(
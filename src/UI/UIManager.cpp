@@ -145,6 +145,31 @@ namespace sfmeditor {
         }
     }
 
+    void UIManager::renderLoadingOverlay(const std::string& label, const float progress,
+                                         const std::function<void()>& onCancel) const {
+        const ImGuiViewport* viewport = ImGui::GetMainViewport();
+        ImGui::SetNextWindowPos(ImVec2(viewport->WorkPos.x + viewport->WorkSize.x * 0.5f,
+                                       viewport->WorkPos.y + viewport->WorkSize.y * 0.5f), ImGuiCond_Always,
+                                ImVec2(0.5f, 0.5f));
+        ImGui::SetNextWindowSize(ImVec2(420.0f, 0.0f));
+
+        constexpr ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove |
+            ImGuiWindowFlags_NoDocking | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_AlwaysAutoResize;
+
+        if (ImGui::Begin("##LoadingOverlay", nullptr, flags)) {
+            ImGui::TextUnformatted(label.c_str());
+
+            char overlay[16];
+            snprintf(overlay, sizeof(overlay), "%.0f%%", progress * 100.0f);
+            ImGui::ProgressBar(progress, ImVec2(-1.0f, 0.0f), overlay);
+
+            if (ImGui::Button("Cancel", ImVec2(-1.0f, 0.0f))) {
+                if (onCancel) onCancel();
+            }
+        }
+        ImGui::End();
+    }
+
     void UIManager::renderDockspace() {
         static ImGuiDockNodeFlags dockspaceFlags = ImGuiDockNodeFlags_None;
 
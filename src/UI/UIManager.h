@@ -21,6 +21,7 @@
 #include "Panels/PropertiesPanel.h"
 
 #include <vector>
+#include <string>
 #include <memory>
 #include <functional>
 
@@ -50,6 +51,9 @@ namespace sfmeditor {
 
         void renderPanels() const;
 
+        void renderLoadingOverlay(const std::string& label, float progress,
+                                  const std::function<void()>& onCancel) const;
+
         ViewportPanel* getViewportPanel() const { return m_viewportPanel.get(); }
 
     private: